@@ -1,4 +1,5 @@
 #include <iomanip>
+#include <nano/core/chrono.h>
 #include <nano/core/cmdline.h>
 #include <nano/core/table.h>
 #include <nano/critical.h>
@@ -49,6 +50,61 @@ auto print_params(const ml::result_t& result)
     }
 }
 
+auto make_dataset(const datasource_t& datasource, const strings_t& generator_ids,
+                  const size_t threads = parallel::pool_t::max_size())
+{
+    auto dataset = dataset_t{datasource, threads};
+    for (const auto& generator_id : generator_ids)
+    {
+        dataset.add(generator_t::all().get(generator_id));
+    }
+    return dataset;
+}
+
+int benchmark_threads(const cmdresult_t& options, cmdconfig_t& rconfig, const rwlearners_t& wlearners,
+                      const datasource_t& datasource, const strings_t& generator_ids, const loss_t& loss,
+                      const ml::params_t& fit_params)
+{
+    const auto max_threads = options.get<size_t>("--max-threads");
+    const auto samples     = datasource.train_samples();
+
+    // measure the hyper-parameter tuning throughput (fitted models per second) with increasing number of threads
+    auto table = table_t{};
+    table.header() << "threads" << "models" << "time [s]" << "models/s" << "speedup";
+    table.delim();
+
+    auto thread_counts = std::vector<size_t>{};
+    for (size_t threads = 1U; threads < max_threads; threads *= 2U)
+    {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(std::max(max_threads, size_t{1U}));
+
+    auto baseline = 0.0;
+    for (const auto threads : thread_counts)
+    {
+        const auto dataset = make_dataset(datasource, generator_ids, threads);
+
+        auto model = gboost_model_t{};
+        rconfig.setup(model);
+        model.prototypes(wlearners);
+
+        const auto timer      = ::nano::timer_t{};
+        const auto fit_result = model.fit(dataset, samples, loss, fit_params);
+        const auto seconds    = static_cast<scalar_t>(timer.milliseconds().count()) * 1e-3;
+        const auto models     = fit_result.trials() * fit_result.folds();
+        const auto throughput = static_cast<scalar_t>(models) / std::max(seconds, 1e-3);
+
+        baseline = (threads == thread_counts.front()) ? throughput : baseline;
+
+        table.append() << threads << models << print_scalar(seconds) << print_scalar(throughput)
+                       << print_scalar(throughput / baseline);
+        std::cout << table;
+    }
+
+    return EXIT_SUCCESS;
+}
+
 int unsafe_main(int argc, const char* argv[])
 {
     // parse the command line
@@ -62,6 +118,8 @@ int unsafe_main(int argc, const char* argv[])
     cmdline.add("--generator", "regex to select feature generation methods", "identity.+");
     cmdline.add("--wlearner", "regex to select weak learners", "<mandatory>");
     cmdline.add("--list-gboost-params", "list the parameters of the gradient boosting model");
+    cmdline.add("--benchmark-threads", "benchmark the hyper-parameter tuning throughput with the number of threads");
+    cmdline.add("--max-threads", "maximum number of threads to benchmark", parallel::pool_t::max_size());
 
     const auto options = cmdline.process(argc, argv);
     if (cmdline.handle(options))
@@ -114,12 +172,14 @@ int unsafe_main(int argc, const char* argv[])
 
     // load dataset
     rdatasource->load();
-    auto dataset = dataset_t{*rdatasource};
-    for (const auto& generator_id : generator_ids)
+    if (options.has("--benchmark-threads"))
     {
-        dataset.add(generator_t::all().get(generator_id));
+        const auto fit_params = ml::params_t{}.solver(*rsolver).tuner(*rtuner);
+        return benchmark_threads(options, rconfig, wlearners, *rdatasource, generator_ids, *rloss, fit_params);
     }
 
+    const auto dataset = make_dataset(*rdatasource, generator_ids);
+
     // train the model using nested cross-validation with respecting the datasource's test samples (if given):
     //  for each outer fold...
     //      make (training, validation) split
@@ -68,8 +68,8 @@ scalar_t reduce_st(const matrix_t& targets, const matrix_t& outputs)
     return value / static_cast<scalar_t>(targets.rows());
 }
 
-template <class toperator>
-scalar_t reduce_mt(parallel::pool_t& pool, const matrix_t& targets, const matrix_t& outputs)
+template <class toperator, class tpool>
+scalar_t reduce_mt(tpool& pool, const matrix_t& targets, const matrix_t& outputs)
 {
     auto values = make_full_vector<scalar_t>(static_cast<tensor_size_t>(pool.size()), 0);
     pool.map(targets.rows(), [&](tensor_size_t i, size_t t)
@@ -112,7 +112,8 @@ bool close(const scalar_t v1, const scalar_t v2, const char* name, const scalar_
 template <class toperator>
 bool evaluate(const tensor_size_t min_size, const tensor_size_t max_size, table_t& table)
 {
-    parallel::pool_t pool;
+    parallel::pool_t      pool;
+    parallel::scheduler_t scheduler;
 
     std::vector<scalar_t> single_deltas;
     std::vector<scalar_t> single_values;
@@ -161,10 +162,30 @@ bool evaluate(const tensor_size_t min_size, const tensor_size_t max_size, table_
         }
     }
 
+    // multi-threaded (using the work-stealing scheduler)
+    auto& row3 = table.append();
+    row3 << scat("reduce-", toperator::name()) << scat("wsched(x", scheduler.size(), ")");
+    for (size_t i = 0; i < single_deltas.size(); ++i)
+    {
+        const auto  deltaST = single_deltas[i];
+        const auto  valueST = single_values[i];
+        const auto& targets = single_targets[i];
+        const auto& outputs = single_outputs[i];
+
+        scalar_t   valueMT = 0;
+        const auto deltaMT =
+            measure<nanoseconds_t>([&] { valueMT = reduce_mt<toperator>(scheduler, targets, outputs); }, 16);
+        row3 << scat(std::setprecision(2), std::fixed, deltaST / static_cast<double>(deltaMT.count()));
+        if (!close(valueST, valueMT, "wsched", epsilon1<scalar_t>()))
+        {
+            return false;
+        }
+    }
+
 #ifdef _OPENMP
     // multi-threaded (using OpenMP)
-    auto& row3 = table.append();
-    row3 << scat("reduce-", toperator::name()) << "openmp";
+    auto& row4 = table.append();
+    row4 << scat("reduce-", toperator::name()) << "openmp";
     for (size_t i = 0; i < single_deltas.size(); ++i)
     {
         const auto  deltaST = single_deltas[i];
@@ -174,7 +195,7 @@ bool evaluate(const tensor_size_t min_size, const tensor_size_t max_size, table_
 
         scalar_t   valueMT = 0;
         const auto deltaMT = measure<nanoseconds_t>([&] { valueMT = reduce_op<toperator>(targets, outputs); }, 16);
-        row3 << scat(std::setprecision(2), std::fixed, deltaST / static_cast<double>(deltaMT.count()));
+        row4 << scat(std::setprecision(2), std::fixed, deltaST / static_cast<double>(deltaMT.count()));
         if (!close(valueST, valueMT, "openmp", epsilon1<scalar_t>()))
         {
             return false;
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <condition_variable>
 #include <deque>
+#include <exception>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <nano/arch.h>
 #include <thread>
@@ -249,4 +253,180 @@ private:
     std::vector<worker_t>    m_workers; ///<
     queue_t                  m_queue;   ///< tasks to execute + synchronization
 };
+
+///
+/// \brief work-stealing thread pool with a fixed number of threads.
+///
+/// NB: the elements to process are split into contiguous ranges that are distributed to per-worker deques:
+///     - each worker processes the most recent range of its own deque by recursively splitting it in halves
+///         (until the grain size is reached) and by pushing back the unprocessed halves,
+///     - the idle workers steal the oldest (and thus the largest) ranges from the other workers' deques.
+///
+/// NB: no task or future is allocated per element, the ranges are processed in place.
+/// NB: calling `map` from one of its worker threads (nested parallelism) is supported:
+///     the calling worker processes the ranges of the nested call while the idle workers can steal them.
+///
+class NANO_PUBLIC scheduler_t
+{
+public:
+    ///
+    /// \brief constructor
+    ///
+    explicit scheduler_t();
+    explicit scheduler_t(size_t threads);
+
+    ///
+    /// \brief disable copying
+    ///
+    scheduler_t(const scheduler_t&)            = delete;
+    scheduler_t& operator=(const scheduler_t&) = delete;
+
+    ///
+    /// \brief disable moving
+    ///
+    scheduler_t(scheduler_t&&) noexcept            = delete;
+    scheduler_t& operator=(scheduler_t&&) noexcept = delete;
+
+    ///
+    /// \brief destructor
+    ///
+    ~scheduler_t();
+
+    ///
+    /// \brief returns the process-wide scheduler using all available threads.
+    ///
+    /// NB: submitting the outer (e.g. hyper-parameter tuning) and the inner (e.g. feature processing) loops
+    ///     to the same scheduler avoids oversubscribing the cores with the threads of multiple pools.
+    ///
+    static scheduler_t& shared();
+
+    ///
+    /// \brief returns the number of available worker threads.
+    ///
+    size_t size() const { return m_deques.size(); }
+
+    ///
+    /// \brief process the given number of elements in parallel and
+    ///     wait for all results to be available (map-reduce).
+    ///
+    /// NB: the operator receives the element index to process and the assigned thread index:
+    ///     op(index, tnum)
+    ///
+    template <class tsize, class toperator>
+    requires std::is_integral_v<tsize>
+    void map(tsize elements, const toperator& op, bool raise = true)
+    {
+        const auto size  = static_cast<size_t>(elements);
+        const auto grain = std::max(size_t{1}, size / (8U * this->size()));
+
+        const auto callback = [&](const size_t begin, const size_t end, const size_t tnum)
+        {
+            for (auto index = begin; index < end; ++index)
+            {
+                op(static_cast<tsize>(index), tnum);
+            }
+        };
+
+        job_t job{size, grain, callback};
+        run(job, raise);
+    }
+
+    ///
+    /// \brief process the given number of elements in parallel in chunks of fixed size
+    ///     and wait for all results to be available (map-reduce).
+    ///
+    /// NB: the operator receives the range [begin, end) of elements to process and the assigned thread index:
+    ///     op(begin, end, tnum)
+    ///
+    template <class tsize, class toperator>
+    requires std::is_integral_v<tsize>
+    void map(tsize elements, tsize chunksize, const toperator& op, bool raise = true)
+    {
+        assert(chunksize >= tsize(1));
+
+        const auto size  = static_cast<size_t>(elements);
+        const auto grain = static_cast<size_t>(chunksize);
+
+        const auto callback = [&](const size_t begin, const size_t end, const size_t tnum)
+        {
+            for (auto chunk = begin; chunk < end; chunk += grain)
+            {
+                op(static_cast<tsize>(chunk), static_cast<tsize>(std::min(chunk + grain, end)), tnum);
+            }
+        };
+
+        job_t job{size, grain, callback};
+        run(job, raise);
+    }
+
+private:
+    ///
+    /// \brief elements to process with a type-erased (non-owning) operator.
+    ///
+    class job_t
+    {
+    public:
+        template <class tcallback>
+        job_t(const size_t elements, const size_t grain, const tcallback& callback)
+            : m_elements(elements)
+            , m_grain(grain)
+            , m_pending(elements)
+            , m_callback(&callback)
+            , m_invoke([](const void* data, const size_t begin, const size_t end, const size_t tnum)
+                       { (*static_cast<const tcallback*>(data))(begin, end, tnum); })
+        {
+        }
+
+        void operator()(size_t begin, size_t end, size_t tnum);
+
+        bool done() const { return m_pending.load() == 0U; }
+
+        using invoke_t = void (*)(const void*, size_t, size_t, size_t);
+
+        // attributes
+        size_t              m_elements{0U}; ///< total number of elements to process
+        size_t              m_grain{1U};    ///< maximum number of elements to process at once
+        std::atomic<size_t> m_pending{0U};  ///< number of elements not processed yet
+        const void*         m_callback{};   ///< operator to call for a range of elements
+        invoke_t            m_invoke{};     ///< type-erased call of the operator
+        std::mutex          m_mutex;        ///< synchronization when setting the exception
+        std::exception_ptr  m_exception;    ///< first exception raised by the operator (if any)
+    };
+
+    ///
+    /// \brief range of elements [begin, end) to process for a given job.
+    ///
+    struct range_t
+    {
+        job_t* m_job{nullptr}; ///<
+        size_t m_begin{0U};    ///<
+        size_t m_end{0U};      ///<
+    };
+
+    ///
+    /// \brief per-worker deque of ranges to process.
+    ///
+    struct alignas(64) deque_t
+    {
+        std::mutex          m_mutex;  ///<
+        std::deque<range_t> m_ranges; ///<
+    };
+
+    void run(job_t& job, bool raise);
+    void push(size_t tnum, const range_t& range);
+    bool pop(size_t tnum, const job_t* job, range_t& range);
+    bool steal(size_t tnum, const job_t* job, range_t& range);
+    void process(size_t tnum, range_t range);
+    void work(size_t tnum);
+
+    // attributes
+    std::vector<std::thread>              m_threads;      ///<
+    std::vector<std::unique_ptr<deque_t>> m_deques;       ///< per-worker ranges to process
+    std::atomic<size_t>                   m_queued{0U};   ///< number of ranges in all deques
+    std::atomic<size_t>                   m_sleeping{0U}; ///< number of workers waiting for new ranges
+    std::mutex                            m_mutex;        ///< synchronization for sleeping & waking up
+    std::condition_variable               m_condition;    ///< signaling new ranges
+    std::condition_variable               m_finished;     ///< signaling finished jobs
+    bool                                  m_stop{false};  ///< stop requested
+};
 } // namespace nano::parallel
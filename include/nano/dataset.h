@@ -1,6 +1,11 @@
 #pragma once
 
+#include <map>
+#include <mutex>
+#include <nano/core/overloaded.h>
 #include <nano/core/parallel.h>
+#include <nano/dataset/quantize.h>
+#include <nano/dataset/sparse.h>
 #include <nano/generator.h>
 
 namespace nano
@@ -14,6 +19,9 @@ public:
     ///
     /// \brief constructor
     ///
+    /// NB: the process-wide scheduler is used if requesting all available threads,
+    ///     otherwise a dedicated scheduler is created with the given number of threads.
+    ///
     explicit dataset_t(const datasource_t&, size_t threads = parallel::pool_t::max_size());
 
     ///
@@ -79,6 +87,22 @@ public:
     ///
     tensor2d_map_t flatten(indices_cmap_t samples, tensor2d_t& buffer) const;
 
+    ///
+    /// \brief returns the flatten feature values for all features on a given subset of samples
+    ///     using the hybrid dense-sparse representation (see sparse_flatten_t).
+    ///
+    /// NB: the one-hot encoded columns of the categorical features are stored sparsely
+    ///     (with the default value -1) if all the features of their generator are categorical.
+    ///
+    void flatten(indices_cmap_t samples, sparse_flatten_t& buffer) const;
+
+    ///
+    /// \brief returns the indices of the flatten columns stored densely, respectively sparsely (see sparse_flatten_t).
+    ///
+    indices_cmap_t dense_columns() const { return m_dense_columns; }
+
+    indices_cmap_t sparse_columns() const { return m_sparse_columns; }
+
     ///
     /// \brief returns the flatten targets on a given subset of samples.
     ///
@@ -100,6 +124,38 @@ public:
     scalar_cmap_t select(indices_cmap_t samples, tensor_size_t feature, scalar_mem_t& buffer) const;
     struct_cmap_t select(indices_cmap_t samples, tensor_size_t feature, struct_mem_t& buffer) const;
 
+    ///
+    /// \brief returns the values of a scalar feature on a given subset of samples
+    ///     as stored originally without copying (if possible, see generator_t::view).
+    ///
+    /// NB: the scalar features are mapped without copying by `select` as well,
+    ///     if stored originally with the same precision as `scalar_t`.
+    ///
+    scalar_view_t view(indices_cmap_t samples, tensor_size_t feature) const;
+
+    ///
+    /// \brief call the given operator with the values of a scalar feature on a given subset of samples:
+    ///     - either as stored originally without copying or converting (if possible, see generator_t::view),
+    ///     - or as gathered into the given buffer (see select).
+    ///
+    /// NB: the signature of the operator is: op(tensor_cmap_t<tscalar, 1> values) with any arithmetic `tscalar`.
+    /// NB: the missing feature values are given as NaN only if the values are gathered into the given buffer.
+    ///
+    template <class toperator>
+    auto visit(indices_cmap_t samples, const tensor_size_t feature, scalar_mem_t& buffer, const toperator& op) const
+    {
+        return std::visit(overloaded{[&](const std::monostate&) { return op(select(samples, feature, buffer)); },
+                                     [&](const auto& values) { return op(values); }},
+                          view(samples, feature));
+    }
+
+    ///
+    /// \brief returns the quantized values of the scalar features using at most the given number of bins.
+    ///
+    /// NB: the quantization is computed once using all samples and it is cached until the features change.
+    ///
+    const quantized_features_t& quantize(tensor_size_t bins) const;
+
     ///
     /// \brief returns the appropriate mathine learning task (by inspecting the target feature).
     ///
@@ -116,9 +172,9 @@ public:
     size_t concurrency() const { return m_pool->size(); }
 
     ///
-    /// \brief returns the builtin thread pool.
+    /// \brief returns the scheduler used for processing in parallel.
     ///
-    parallel::pool_t& thread_pool() const { return *m_pool; }
+    parallel::scheduler_t& thread_pool() const { return *m_pool; }
 
     ///
     /// \brief returns the original data source.
@@ -127,6 +183,7 @@ public:
 
 private:
     void                update();
+    void                uncache() const;
     void                check(tensor_size_t feature) const;
     void                check(indices_cmap_t samples) const;
     const rgenerator_t& byfeature(tensor_size_t feature) const;
@@ -145,17 +202,30 @@ private:
 
     // per generator:
     //  - 0: number of columns
+    //  - 1: the columns are stored sparsely (only categorical features)
     using generator_mapping_t = tensor_mem_t<tensor_size_t, 2>;
 
-    using rtpool_t = std::unique_ptr<parallel::pool_t>;
+    using rtpool_t = std::unique_ptr<parallel::scheduler_t>;
+
+    struct cache_t
+    {
+        std::mutex                                     m_mutex;     ///<
+        std::map<tensor_size_t, quantized_features_t> m_quantized; ///< quantized features per number of bins
+    };
+
+    using rcache_t = std::unique_ptr<cache_t>;
 
     // attributes
-    const datasource_t& m_datasource;        ///<
-    rgenerators_t       m_generators;        ///<
-    column_mapping_t    m_column_mapping;    ///<
-    feature_mapping_t   m_feature_mapping;   ///<
-    generator_mapping_t m_generator_mapping; ///<
-    feature_t           m_target;            ///<
-    rtpool_t            m_pool;              ///< thread pool to speed-up feature generation
+    const datasource_t&    m_datasource;        ///<
+    rgenerators_t          m_generators;        ///<
+    column_mapping_t       m_column_mapping;    ///<
+    feature_mapping_t      m_feature_mapping;   ///<
+    generator_mapping_t    m_generator_mapping; ///<
+    indices_t              m_dense_columns;     ///< flatten columns stored densely
+    indices_t              m_sparse_columns;    ///< flatten columns stored sparsely (one-hot encoded categorical)
+    feature_t              m_target;            ///<
+    rtpool_t               m_owned_pool;        ///< dedicated scheduler (if not using the process-wide one)
+    parallel::scheduler_t* m_pool{nullptr};     ///< scheduler to speed-up feature generation
+    rcache_t               m_cache;             ///< cached values derived from the generated features
 };
 } // namespace nano
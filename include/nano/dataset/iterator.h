@@ -1,6 +1,7 @@
 #pragma once
 
 #include <nano/dataset.h>
+#include <nano/dataset/precision.h>
 #include <nano/dataset/stats.h>
 #include <nano/generator/storage.h>
 
@@ -15,6 +16,21 @@ using targets_callback_t         = std::function<void(tensor_range_t, size_t, te
 using flatten_callback_t         = std::function<void(tensor_range_t, size_t, tensor2d_cmap_t)>;
 using flatten_targets_callback_t = std::function<void(tensor_range_t, size_t, tensor2d_cmap_t, tensor4d_cmap_t)>;
 
+///
+/// \brief callbacks useful for dense models with single precision flatten feature values (see precision_type).
+///
+using flatten32_t                  = tensor_mem_t<float, 2>;
+using flatten32_cmap_t             = tensor_cmap_t<float, 2>;
+using flatten32_callback_t         = std::function<void(tensor_range_t, size_t, flatten32_cmap_t)>;
+using flatten32_targets_callback_t = std::function<void(tensor_range_t, size_t, flatten32_cmap_t, tensor4d_cmap_t)>;
+
+///
+/// \brief callbacks useful for linear models with flatten feature values
+///     stored using the hybrid dense-sparse representation (see sparse_flatten_t).
+///
+using sparse_callback_t         = std::function<void(tensor_range_t, size_t, const sparse_flatten_t&)>;
+using sparse_targets_callback_t = std::function<void(tensor_range_t, size_t, const sparse_flatten_t&, tensor4d_cmap_t)>;
+
 ///
 /// \brief callbacks useful for feature selection-based models with the following signature:
 ///     (tensor_size_t feature_index, size_t thread_number, feature_values)
@@ -24,6 +40,15 @@ using mclass_callback_t = std::function<void(tensor_size_t, size_t, mclass_cmap_
 using scalar_callback_t = std::function<void(tensor_size_t, size_t, scalar_cmap_t)>;
 using struct_callback_t = std::function<void(tensor_size_t, size_t, struct_cmap_t)>;
 
+///
+/// \brief callbacks useful for feature selection-based models with the following signature:
+///     (tensor_range_t sample_range, size_t thread_number, feature_values)
+///
+using sclass_range_callback_t = std::function<void(tensor_range_t, size_t, sclass_cmap_t)>;
+using mclass_range_callback_t = std::function<void(tensor_range_t, size_t, mclass_cmap_t)>;
+using scalar_range_callback_t = std::function<void(tensor_range_t, size_t, scalar_cmap_t)>;
+using struct_range_callback_t = std::function<void(tensor_range_t, size_t, struct_cmap_t)>;
+
 ///
 /// \brief base iterator to loop through generated input and target feature values.
 ///
@@ -132,6 +157,52 @@ private:
     mutable buffers_t m_targets_buffers;             ///< per-thread buffer
 };
 
+///
+/// \brief flatten feature values of a set of samples cached once in memory and
+///     shared by flatten iterators (e.g. across the folds and the trials of hyper-parameter tuning).
+///
+/// NB: the feature values are not scaled as the scaling statistics depend on the samples of each iterator.
+///
+class NANO_PUBLIC flatten_cache_t
+{
+public:
+    ///
+    /// \brief constructor
+    ///
+    flatten_cache_t(const dataset_t&, indices_cmap_t samples, precision_type = precision_type::float64,
+                    tensor_size_t batch = 100);
+
+    ///
+    /// \brief returns true if the feature values of the given samples are cached.
+    ///
+    bool cached(indices_cmap_t samples) const;
+
+    ///
+    /// \brief copy the (unscaled) feature values of the given samples.
+    ///
+    void gather(indices_cmap_t samples, tensor2d_map_t flatten) const;
+
+    ///
+    /// \brief returns the wrapped feature dataset.
+    ///
+    const dataset_t& dataset() const { return m_dataset; }
+
+    ///
+    /// \brief returns the floating point precision of the cached feature values.
+    ///
+    precision_type precision() const { return m_precision; }
+
+private:
+    // attributes
+    const dataset_t& m_dataset;   ///<
+    precision_type   m_precision; ///<
+    indices_t        m_rows;      ///< row of the cached feature values for each sample (negative if not cached)
+    tensor2d_t       m_flatten;   ///< cached feature values: (#samples, #columns)
+    flatten32_t      m_flatten32; ///< cached feature values (single precision): (#samples, #columns)
+};
+
+using rflatten_cache_t = std::shared_ptr<const flatten_cache_t>;
+
 ///
 /// \brief iterator to loop through flatten feature values and target values
 ///     useful for training and evaluating dense models.
@@ -149,8 +220,59 @@ public:
     ///
     /// \brief returns true if the flatten feature values can be cached in memory in the given number of bytes.
     ///
+    /// NB: the feature values are cached with the current floating point precision (see precision_type).
+    ///
     bool cache_flatten(tensor_size_t max_bytes);
 
+    ///
+    /// \brief cache in memory the flatten feature values of as many (leading) samples as possible
+    ///     in the given number of bytes and spill the remaining ones to the given scratch file.
+    ///
+    /// NB: the scratch file uses the same flatten layout (row-major, one row per sample) and
+    ///     the same floating point precision as the in-memory cache.
+    /// NB: the spilled feature values are read by batch while looping and the next batch of each thread
+    ///     is prefetched in the background while the current one is processed (double-buffering).
+    /// NB: the scratch file is removed when the cached feature values are discarded.
+    ///
+    /// returns the number of samples cached in memory.
+    ///
+    tensor_size_t cache_flatten(tensor_size_t max_bytes, const string_t& scratch_path);
+
+    ///
+    /// \brief use the given shared cache of flatten feature values (scaled on the fly by batch).
+    ///
+    /// NB: the cached values are not copied, so that the memory usage does not increase with
+    ///     the number of iterators using the same cache.
+    ///
+    /// returns true if all the samples of the iterator are available in the given cache.
+    ///
+    bool cache_flatten(rflatten_cache_t);
+
+    ///
+    /// \brief returns true if the flatten feature values can be cached in memory in the given number of bytes
+    ///     using the hybrid dense-sparse representation (see sparse_flatten_t).
+    ///
+    /// NB: the number of bytes is known only after generating the sparse entries of all samples.
+    ///
+    bool cache_sparse(tensor_size_t max_bytes);
+
+    ///
+    /// \brief returns true if the flatten feature values are cached using the hybrid dense-sparse representation.
+    ///
+    bool sparse() const { return m_sparse.samples() == samples().size(); }
+
+    ///
+    /// \brief change the floating point precision of the flatten feature values.
+    ///
+    /// NB: the cached feature values (if any) are discarded.
+    ///
+    void precision(precision_type);
+
+    ///
+    /// \brief returns the floating point precision of the flatten feature values.
+    ///
+    precision_type precision() const { return m_precision; }
+
     ///
     /// \brief loop through flatten feature values with the following callback:
     ///     - op(tensor_range_t sample_range, size_t thread_number, tensor2d_cmap_t flatten)
@@ -164,21 +286,62 @@ public:
     ///
     void loop(const flatten_targets_callback_t&) const;
 
+    ///
+    /// \brief loop through single precision flatten feature values (and the associated targets).
+    ///
+    /// NB: the feature values are scaled in double precision and then converted to single precision.
+    ///
+    void loop(const flatten32_callback_t&) const;
+    void loop(const flatten32_targets_callback_t&) const;
+
+    ///
+    /// \brief loop through flatten feature values (and the associated targets)
+    ///     using the hybrid dense-sparse representation (see sparse_flatten_t).
+    ///
+    /// NB: the feature values are scaled in double precision like for the dense representation,
+    ///     including the default values of the sparse columns.
+    ///
+    void loop(const sparse_callback_t&) const;
+    void loop(const sparse_targets_callback_t&) const;
+
     ///
     /// \brief returns statistics of the flatten feature values.
     ///
     const scalar_stats_t& flatten_stats() const { return m_flatten_stats; }
 
 private:
-    tensor2d_cmap_t flatten(tensor2d_map_t) const;
-    tensor2d_cmap_t flatten(size_t tnum, const tensor_range_t& range) const;
+    class spill_t;
+
+    void             discard();
+    tensor2d_cmap_t  flatten(tensor2d_map_t) const;
+    tensor2d_cmap_t  generate(size_t tnum, const tensor_range_t& range) const;
+    tensor2d_cmap_t  flatten(size_t tnum, const tensor_range_t& range) const;
+    flatten32_cmap_t flatten32(size_t tnum, const tensor_range_t& range) const;
 
-    using buffers_t = std::vector<tensor2d_t>;
+    tensor2d_t              sparse_values() const;
+    const sparse_flatten_t& sparse(size_t tnum, const tensor_range_t& range, const scalar_stats_t& dense_stats,
+                                   const tensor2d_t& sparse_values) const;
+
+    template <class tscalar>
+    tensor_cmap_t<tscalar, 2> spilled(const tensor_mem_t<tscalar, 2>& cached, tensor_mem_t<tscalar, 2>& buffer,
+                                      size_t tnum, const tensor_range_t& range) const;
+
+    using buffers_t   = std::vector<tensor2d_t>;
+    using buffers32_t = std::vector<flatten32_t>;
+    using sbuffers_t  = std::vector<sparse_flatten_t>;
+    using rspill_t    = std::shared_ptr<spill_t>;
 
     // attributes
-    scalar_stats_t    m_flatten_stats;   ///< statistics for flatten feature values
-    mutable buffers_t m_flatten_buffers; ///< per-thread buffer
-    tensor2d_t        m_flatten;         ///< cached feature values
+    scalar_stats_t      m_flatten_stats;                      ///< statistics for flatten feature values
+    precision_type      m_precision{precision_type::float64}; ///< precision of the flatten feature values
+    mutable buffers_t   m_flatten_buffers;                    ///< per-thread buffer
+    mutable buffers32_t m_flatten32_buffers;                  ///< per-thread buffer (single precision)
+    mutable sbuffers_t  m_sparse_buffers;                     ///< per-thread buffer (dense-sparse)
+    tensor2d_t          m_flatten;                            ///< cached feature values
+    flatten32_t         m_flatten32;                          ///< cached feature values (single precision)
+    rspill_t            m_spill;                              ///< feature values spilled to disk (if any)
+    rflatten_cache_t    m_shared;                             ///< shared cached feature values (if any)
+    sparse_flatten_t    m_sparse;                             ///< cached feature values (dense-sparse)
 };
 
 ///
@@ -204,12 +367,17 @@ public:
 
     ///
     /// \brief loop through the samples of the given feature compatible type with the following callback:
-    ///     - op(tensor_size_t feature_index, size_t thread_number, ... feature_values)
+    ///     - op(tensor_range_t sample_range, size_t thread_number, ... feature_values)
+    ///
+    /// NB: the samples are split in contiguous ranges processed in parallel,
+    ///     so the callback is called concurrently for disjoint sample ranges.
+    /// NB: the feature values are gathered in buffers allocated for each call, so that
+    ///     these loops are reentrant and can be called from within the tasks of the thread pool.
     ///
-    void loop(indices_cmap_t samples, tensor_size_t feature, const sclass_callback_t&) const;
-    void loop(indices_cmap_t samples, tensor_size_t feature, const mclass_callback_t&) const;
-    void loop(indices_cmap_t samples, tensor_size_t feature, const scalar_callback_t&) const;
-    void loop(indices_cmap_t samples, tensor_size_t feature, const struct_callback_t&) const;
+    void loop(indices_cmap_t samples, tensor_size_t feature, const sclass_range_callback_t&) const;
+    void loop(indices_cmap_t samples, tensor_size_t feature, const mclass_range_callback_t&) const;
+    void loop(indices_cmap_t samples, tensor_size_t feature, const scalar_range_callback_t&) const;
+    void loop(indices_cmap_t samples, tensor_size_t feature, const struct_range_callback_t&) const;
 
     ///
     /// \brief loop through the given features of the compatible type with the following callback:
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <nano/enum.h>
+
+namespace nano
+{
+///
+/// \brief floating point precision used for computing and caching the flatten input features.
+///
+enum class precision_type : uint8_t
+{
+    float64 = 0, ///< double precision
+    float32,     ///< single precision: half the memory and faster dense matrix products
+};
+
+template <>
+inline enum_map_t<precision_type> enum_string()
+{
+    return {
+        {precision_type::float64, "float64"},
+        {precision_type::float32, "float32"}
+    };
+}
+} // namespace nano
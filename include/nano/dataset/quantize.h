@@ -0,0 +1,91 @@
+#pragma once
+
+#include <nano/tensor.h>
+
+namespace nano
+{
+class dataset_t;
+
+///
+/// \brief quantized (binned) values of the scalar continuous features,
+///     useful for fitting weak learners by scanning per-bin statistics instead of sorting the feature values.
+///
+/// NB: the bin thresholds are estimated once using the feature values of all samples:
+///     - each distinct feature value is assigned to its own bin if there are few enough of them or
+///     - the bins are chosen to contain roughly the same number of samples otherwise.
+///
+/// NB: a feature value is mapped to the bin `b` if thresholds(b - 1) <= value < thresholds(b).
+/// NB: the missing feature values are mapped to the reserved bin code `missing_bin`.
+///
+class NANO_PUBLIC quantized_features_t
+{
+public:
+    using codes_t      = tensor_mem_t<uint8_t, 2>;
+    using codes_cmap_t = tensor_cmap_t<uint8_t, 1>;
+
+    static constexpr auto max_bins    = tensor_size_t{255};
+    static constexpr auto missing_bin = uint8_t{255};
+
+    ///
+    /// \brief default constructor
+    ///
+    quantized_features_t() = default;
+
+    ///
+    /// \brief constructor
+    ///
+    quantized_features_t(const dataset_t&, tensor_size_t bins);
+
+    ///
+    /// \brief returns the maximum number of bins per feature.
+    ///
+    tensor_size_t bins() const { return m_bins; }
+
+    ///
+    /// \brief returns the indices of the quantized features.
+    ///
+    const indices_t& features() const { return m_features; }
+
+    ///
+    /// \brief returns true if the given feature is quantized.
+    ///
+    bool quantized(const tensor_size_t feature) const
+    {
+        return feature >= 0 && feature < m_mapping.size() && m_mapping(feature) >= 0;
+    }
+
+    ///
+    /// \brief returns the number of bins used by the given feature.
+    ///
+    tensor_size_t bins(const tensor_size_t feature) const { return m_counts(index(feature)); }
+
+    ///
+    /// \brief returns the thresholds between consecutive bins of the given feature.
+    ///
+    auto thresholds(const tensor_size_t feature) const
+    {
+        const auto ifeature = index(feature);
+        return m_thresholds.tensor(ifeature).slice(0, m_counts(ifeature) - 1);
+    }
+
+    ///
+    /// \brief returns the bin codes of the given feature for all samples.
+    ///
+    codes_cmap_t codes(const tensor_size_t feature) const { return m_codes.tensor(index(feature)); }
+
+private:
+    tensor_size_t index(const tensor_size_t feature) const
+    {
+        assert(quantized(feature));
+        return m_mapping(feature);
+    }
+
+    // attributes
+    tensor_size_t m_bins{0};    ///< maximum number of bins per feature
+    indices_t     m_features;   ///< indices of the quantized features
+    indices_t     m_mapping;    ///< (#features,) - index of the feature in the quantized ones, if >= 0
+    indices_t     m_counts;     ///< (#quantized features,) - number of bins per feature
+    tensor2d_t    m_thresholds; ///< (#quantized features, #bins - 1) - thresholds between consecutive bins
+    codes_t       m_codes;      ///< (#quantized features, #samples) - bin codes
+};
+} // namespace nano
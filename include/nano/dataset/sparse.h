@@ -0,0 +1,51 @@
+#pragma once
+
+#include <nano/tensor.h>
+
+namespace nano
+{
+///
+/// \brief flatten feature values of a set of samples stored using a hybrid dense-sparse representation:
+///     - the columns of the continuous features are stored densely and
+///     - the one-hot encoded columns of the categorical features are stored sparsely
+///         (compressed sparse rows) as most of them take the same default value.
+///
+/// NB: the value of the sparse column j for sample i is:
+///     - m_values(k) if there is an entry k in [m_offsets(i), m_offsets(i + 1)) with m_columns(k) == j, or
+///     - m_defaults(j) otherwise.
+///
+/// NB: the memory usage and the cost of the matrix products scale with the number of sparse entries,
+///     which is the number of active labels (plus the number of columns of the missing categorical features).
+///
+struct NANO_PUBLIC sparse_flatten_t
+{
+    ///
+    /// \brief returns the number of samples.
+    ///
+    tensor_size_t samples() const { return m_dense.size<0>(); }
+
+    ///
+    /// \brief returns the total number of flatten columns.
+    ///
+    tensor_size_t columns() const { return m_dense_columns.size() + m_sparse_columns.size(); }
+
+    ///
+    /// \brief write the flatten feature values of the given sample densely.
+    ///
+    void densify(tensor_size_t sample, tensor1d_map_t values) const;
+
+    ///
+    /// \brief write the flatten feature values of all samples densely.
+    ///
+    void densify(tensor2d_map_t values) const;
+
+    // attributes
+    indices_cmap_t m_dense_columns;  ///< flatten column index of each dense column
+    indices_cmap_t m_sparse_columns; ///< flatten column index of each sparse column
+    tensor1d_t     m_defaults;       ///< default value of each sparse column: (#sparse columns,)
+    tensor2d_t     m_dense;          ///< values of the dense columns: (#samples, #dense columns)
+    indices_t      m_offsets;        ///< range of sparse entries of each sample: (#samples + 1,)
+    indices_t      m_columns;        ///< sparse column index of each sparse entry: (#entries,)
+    tensor1d_t     m_values;         ///< value of each sparse entry: (#entries,)
+};
+} // namespace nano
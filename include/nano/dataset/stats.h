@@ -59,6 +59,11 @@ struct NANO_PUBLIC scalar_stats_t
     static scalar_stats_t make_feature_stats(const dataset_t&, indices_cmap_t samples, tensor_size_t feature,
                                              tensor_size_t batch = 1000);
 
+    ///
+    /// \brief returns the statistics of the given subset of components.
+    ///
+    scalar_stats_t select(indices_cmap_t components) const;
+
     ///
     /// \brief scale down (for numerical stability) the given flatten feature or target values.
     ///
@@ -4,6 +4,7 @@
 #include <nano/datasource/storage.h>
 #include <nano/factory.h>
 #include <nano/loggable.h>
+#include <unordered_map>
 
 namespace nano
 {
@@ -44,6 +45,14 @@ public:
     ///
     void load();
 
+    ///
+    /// \brief save the loaded dataset to the given path using the native binary columnar format.
+    ///
+    /// NB: the file can be memory-mapped to load the dataset in (almost) constant time (see binary_datasource_t).
+    /// NB: any error is considered critical and an exception will be triggered.
+    ///
+    void save(const string_t& path) const;
+
     ///
     /// \brief returns the appropriate mathine learning task (by inspecting the target feature).
     ///
@@ -137,6 +146,13 @@ protected:
     ///
     void resize(tensor_size_t samples, const features_t& features, size_t target);
 
+    ///
+    /// \brief memory-map the dataset saved in the native binary columnar format (see datasource_t::save).
+    ///
+    /// NB: the feature values cannot be modified afterwards.
+    ///
+    void map(const string_t& path);
+
     ///
     /// \brief safely write a feature value for the given sample.
     ///
@@ -160,9 +176,9 @@ private:
 
     bool has_target() const { return m_target < m_storage_range.size<0>(); }
 
-    mask_map_t mask(const tensor_size_t index) { return m_storage_mask.tensor(index); }
+    mask_map_t mask(const tensor_size_t index) { return m_storage_mask.tensor().tensor(index); }
 
-    mask_cmap_t mask(const tensor_size_t index) const { return m_storage_mask.tensor(index); }
+    mask_cmap_t mask(const tensor_size_t index) const { return m_storage_mask.tensor().tensor(index); }
 
     static constexpr auto maxu08 = tensor_size_t(1) << 8;
     static constexpr auto maxu16 = tensor_size_t(1) << 16;
@@ -181,36 +197,36 @@ private:
         switch (feature.type())
         {
         case feature_type::sclass:
-            return (feature.classes() <= maxu08) ? op(feature, m_storage_u08.slice(range).reshape(-1), mask)
-                 : (feature.classes() <= maxu16) ? op(feature, m_storage_u16.slice(range).reshape(-1), mask)
-                 : (feature.classes() <= maxu32) ? op(feature, m_storage_u32.slice(range).reshape(-1), mask)
-                                                 : op(feature, m_storage_u64.slice(range).reshape(-1), mask);
+            return (feature.classes() <= maxu08) ? op(feature, m_storage_u08.tensor().slice(range).reshape(-1), mask)
+                 : (feature.classes() <= maxu16) ? op(feature, m_storage_u16.tensor().slice(range).reshape(-1), mask)
+                 : (feature.classes() <= maxu32) ? op(feature, m_storage_u32.tensor().slice(range).reshape(-1), mask)
+                                                 : op(feature, m_storage_u64.tensor().slice(range).reshape(-1), mask);
         case feature_type::mclass:
-            return op(feature, m_storage_u08.slice(range).reshape(samples, -1), mask);
+            return op(feature, m_storage_u08.tensor().slice(range).reshape(samples, -1), mask);
         case feature_type::float32:
-            return op(feature, m_storage_f32.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_f32.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::float64:
-            return op(feature, m_storage_f64.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_f64.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::int8:
-            return op(feature, m_storage_i08.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_i08.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::int16:
-            return op(feature, m_storage_i16.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_i16.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::int32:
-            return op(feature, m_storage_i32.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_i32.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::int64:
-            return op(feature, m_storage_i64.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_i64.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::uint8:
-            return op(feature, m_storage_u08.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_u08.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::uint16:
-            return op(feature, m_storage_u16.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_u16.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::uint32:
-            return op(feature, m_storage_u32.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_u32.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::uint64:
-            return op(feature, m_storage_u64.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_u64.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         default:
             raise("in-memory dataset: unhandled feature type (", static_cast<int>(feature.type()), ")!");
         }
-        return op(feature, m_storage_u08.slice(range).reshape(-1), mask);
+        return op(feature, m_storage_u08.tensor().slice(range).reshape(-1), mask);
     }
 
     template <class toperator>
@@ -226,45 +242,89 @@ private:
         switch (feature.type())
         {
         case feature_type::sclass:
-            return (feature.classes() <= maxu08) ? op(feature, m_storage_u08.slice(range).reshape(-1), mask)
-                 : (feature.classes() <= maxu16) ? op(feature, m_storage_u16.slice(range).reshape(-1), mask)
-                 : (feature.classes() <= maxu32) ? op(feature, m_storage_u32.slice(range).reshape(-1), mask)
-                                                 : op(feature, m_storage_u64.slice(range).reshape(-1), mask);
+            return (feature.classes() <= maxu08) ? op(feature, m_storage_u08.tensor().slice(range).reshape(-1), mask)
+                 : (feature.classes() <= maxu16) ? op(feature, m_storage_u16.tensor().slice(range).reshape(-1), mask)
+                 : (feature.classes() <= maxu32) ? op(feature, m_storage_u32.tensor().slice(range).reshape(-1), mask)
+                                                 : op(feature, m_storage_u64.tensor().slice(range).reshape(-1), mask);
         case feature_type::mclass:
-            return op(feature, m_storage_u08.slice(range).reshape(samples, -1), mask);
+            return op(feature, m_storage_u08.tensor().slice(range).reshape(samples, -1), mask);
         case feature_type::float32:
-            return op(feature, m_storage_f32.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_f32.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::float64:
-            return op(feature, m_storage_f64.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_f64.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::int8:
-            return op(feature, m_storage_i08.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_i08.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::int16:
-            return op(feature, m_storage_i16.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_i16.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::int32:
-            return op(feature, m_storage_i32.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_i32.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::int64:
-            return op(feature, m_storage_i64.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_i64.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::uint8:
-            return op(feature, m_storage_u08.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_u08.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::uint16:
-            return op(feature, m_storage_u16.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_u16.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::uint32:
-            return op(feature, m_storage_u32.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_u32.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         case feature_type::uint64:
-            return op(feature, m_storage_u64.slice(range).reshape(samples, d0, d1, d2), mask);
+            return op(feature, m_storage_u64.tensor().slice(range).reshape(samples, d0, d1, d2), mask);
         default:
             raise("in-memory dataset: unhandled feature type (", static_cast<int>(feature.type()), ")!");
         }
-        return op(feature, m_storage_u08.slice(range).reshape(-1), mask);
+        return op(feature, m_storage_u08.tensor().slice(range).reshape(-1), mask);
     }
 
     indices_t filter(tensor_size_t count, tensor_size_t condition) const;
 
+    using storage_sizes_t = std::unordered_map<feature_type, tensor_size_t>;
+
+    storage_sizes_t layout(tensor_size_t samples, const features_t& features, size_t target);
+
+    ///
+    /// \brief (feature values, samples) storage either owned or mapped from a read-only memory (e.g. file).
+    ///
     template <class tscalar>
-    using storage_t       = tensor_mem_t<tscalar, 2>;
-    using storage_mask_t  = tensor_mem_t<uint8_t, 2>;
+    class storage_t
+    {
+    public:
+        void resize(const tensor_size_t rows, const tensor_size_t cols)
+        {
+            m_data.resize(rows, cols);
+            m_data.zero();
+            m_mapped = nullptr;
+        }
+
+        void map(const tscalar* data, const tensor_size_t rows, const tensor_size_t cols)
+        {
+            m_data   = tensor_mem_t<tscalar, 2>{};
+            m_mapped = data;
+            m_dims   = make_dims(rows, cols);
+        }
+
+        tensor_map_t<tscalar, 2> tensor()
+        {
+            critical(m_mapped == nullptr, "in-memory dataset: cannot modify memory-mapped feature values!");
+            return m_data.tensor();
+        }
+
+        tensor_cmap_t<tscalar, 2> tensor() const
+        {
+            return (m_mapped != nullptr) ? map_tensor(m_mapped, m_dims) : m_data.tensor();
+        }
+
+    private:
+        // attributes
+        tensor_mem_t<tscalar, 2> m_data;                  ///< owned storage
+        const tscalar*           m_mapped{nullptr};       ///< mapped storage (if any)
+        tensor2d_dims_t          m_dims{make_dims(0, 0)}; ///< dimensions of the mapped storage
+    };
+
+    struct mapping_t;
+
+    using storage_mask_t  = storage_t<uint8_t>;
     using storage_type_t  = std::vector<feature_type>;
     using storage_range_t = tensor_mem_t<tensor_size_t, 2>;
+    using rmapping_t      = std::shared_ptr<const mapping_t>;
 
     // attributes
     indices_t           m_testing;       ///< (#samples,) - mark sample for testing, if != 0
@@ -283,5 +343,6 @@ private:
     storage_mask_t      m_storage_mask;  ///< feature value given if the bit (feature, sample) is 1
     storage_type_t      m_storage_type;  ///<
     storage_range_t     m_storage_range; ///<
+    rmapping_t          m_mapping;       ///< memory-mapped file storing the feature values (if any)
 };
 } // namespace nano
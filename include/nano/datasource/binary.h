@@ -0,0 +1,35 @@
+#pragma once
+
+#include <nano/datasource.h>
+
+namespace nano
+{
+///
+/// \brief machine learning dataset loaded by memory-mapping a file in the native binary columnar format.
+///
+/// NB: the file is created by saving an already loaded dataset (see datasource_t::save) and
+///     it mirrors the in-memory storage of the feature values and of the feature value masks.
+///
+/// NB: loading takes (almost) constant time as the feature values are not copied, but accessed on demand
+///     directly from the file's pages that can be shared across processes by the operating system.
+///
+class NANO_PUBLIC binary_datasource_t : public datasource_t
+{
+public:
+    ///
+    /// \brief constructor, set the path to the binary file (relative to `datasource::basedir` if set).
+    ///
+    binary_datasource_t(string_t id, string_t path);
+
+    ///
+    /// \brief @see clonable_t
+    ///
+    rdatasource_t clone() const override;
+
+private:
+    void do_load() override;
+
+    // attributes
+    string_t m_path; ///< path to the binary file
+};
+} // namespace nano
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <fstream>
+#include <limits>
 #include <nano/string.h>
 #include <nano/tensor/index.h>
 
@@ -9,6 +11,17 @@ namespace nano
 struct csv_t;
 using csvs_t = std::vector<csv_t>;
 
+///
+/// \brief contiguous range of bytes [begin, end) of a CSV file starting at the beginning of a line.
+///
+struct csv_chunk_t
+{
+    std::streamoff m_begin{0}; ///<
+    std::streamoff m_end{0};   ///<
+};
+
+using csv_chunks_t = std::vector<csv_chunk_t>;
+
 ///
 /// \brief describes how a CSV (comma-separated values) file should be read.
 ///
@@ -66,6 +79,93 @@ struct csv_t
         return *this;
     }
 
+    ///
+    /// \brief returns the path of the configured CSV.
+    /// NB: optionally a base directory path can be given as a prefix.
+    ///
+    string_t path(const string_t& basedir) const { return basedir.empty() ? m_path : (basedir + "/" + m_path); }
+
+    ///
+    /// \brief split the configured CSV into (at most) the given number of chunks of similar size,
+    ///     so that each chunk starts at the beginning of a line and it stores complete lines.
+    ///
+    /// NB: the chunks have approximately at least the given number of bytes (if possible).
+    /// NB: an empty list is returned if the file cannot be opened.
+    ///
+    csv_chunks_t split(const string_t& basedir, const size_t chunks, const std::streamoff min_chunk_size = 1) const
+    {
+        std::ifstream stream(path(basedir), std::ios::binary | std::ios::ate);
+        if (!stream.is_open())
+        {
+            return {};
+        }
+
+        const auto size  = static_cast<std::streamoff>(stream.tellg());
+        const auto count = std::clamp(size / std::max(min_chunk_size, std::streamoff{1}), std::streamoff{1},
+                                      static_cast<std::streamoff>(std::max(chunks, size_t{1U})));
+
+        csv_chunks_t result;
+        for (std::streamoff k = 1, begin = 0; begin < size; ++k)
+        {
+            auto end = size;
+            if (k < count)
+            {
+                stream.clear();
+                stream.seekg(std::max(begin, size / count * k));
+                stream.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                end = stream.eof() ? size : static_cast<std::streamoff>(stream.tellg());
+            }
+
+            result.push_back({begin, end});
+            begin = end;
+        }
+
+        return result;
+    }
+
+    ///
+    /// \brief parse the given chunk of the configured CSV and call the given operator for each line.
+    ///
+    /// NB: the line index passed to the operator is relative to the beginning of the chunk.
+    /// NB: optionally a base directory path can be given as a prefix.
+    /// NB: returns the number of lines in the chunk or a negative value if the chunk could not be read
+    ///     or the parsing was stopped by the operator.
+    ///
+    template <class toperator>
+    tensor_size_t parse(const string_t& basedir, const csv_chunk_t& chunk, const toperator& op) const
+    {
+        std::ifstream stream(path(basedir), std::ios::binary);
+
+        string_t buffer(static_cast<size_t>(chunk.m_end - chunk.m_begin), '\0');
+        if (!stream.seekg(chunk.m_begin) || !stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+        {
+            return -1;
+        }
+
+        string_t line;
+        auto     header     = m_header && chunk.m_begin == 0;
+        auto     line_index = tensor_size_t{0};
+        for (size_t begin = 0U, end = 0U; begin < buffer.size(); begin = end + 1U, ++line_index)
+        {
+            end = std::min(buffer.find('\n', begin), buffer.size());
+            line.assign(buffer, begin, end - begin);
+
+            if (header && line_index == 0)
+            {
+                header = false;
+            }
+            else if (!line.empty() && line[0] != m_skip)
+            {
+                if (!op(line, line_index))
+                {
+                    return -1;
+                }
+            }
+        }
+
+        return line_index;
+    }
+
     ///
     /// \brief parse the current configured CSV and call the given operator for each line.
     /// NB: optionally a base directory path can be given as a prefix.
@@ -73,12 +173,10 @@ struct csv_t
     template <class toperator>
     auto parse(const string_t& basedir, const toperator& op) const
     {
-        const auto path = basedir.empty() ? m_path : (basedir + "/" + m_path);
-
         string_t line;
         auto     header     = m_header;
         auto     line_index = tensor_size_t{0};
-        for (std::ifstream stream(path); std::getline(stream, line); ++line_index)
+        for (std::ifstream stream(path(basedir)); std::getline(stream, line); ++line_index)
         {
             if (header && line_index == 0)
             {
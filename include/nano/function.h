@@ -72,6 +72,15 @@ public:
     ///
     scalar_t strong_convexity() const { return m_strong_convexity; }
 
+    ///
+    /// \brief returns whether the function can be evaluated concurrently at different points.
+    ///
+    /// NB: this is the case if evaluating the function doesn't modify any internal buffer or referenced object,
+    ///     so the default implementation of evaluating multiple points (see evaluate) uses all available threads.
+    /// NB: functions with mutable buffers or wrapping other functions (e.g. penalty functions) should disable it.
+    ///
+    bool reentrant() const { return m_reentrant; }
+
     ///
     /// \brief register a new constraint.
     ///
@@ -129,6 +138,26 @@ public:
 
     scalar_t operator()(vector_cmap_t x, vector_map_t gx = {}, matrix_map_t Hx = {}) const;
 
+    ///
+    /// \brief evaluate the product of the function's Hessian at the given point with the given vector: Hx * v.
+    ///
+    /// NB: the function must be smooth.
+    /// NB: the default implementation evaluates the full Hessian (thus O(n^2) memory),
+    ///     but it can be overridden with a matrix-free implementation (e.g. for linear models).
+    /// NB: each call is counted as a Hessian evaluation.
+    ///
+    void hessian_vector(vector_cmap_t x, vector_cmap_t v, vector_map_t Hv) const;
+
+    ///
+    /// \brief evaluate the function's values at multiple points (stored as rows) of size (k, n)
+    ///     and optionally its gradients (or sub-gradients if not smooth) of size (k, n).
+    ///
+    /// NB: the default implementation evaluates each point independently (in parallel if reentrant),
+    ///     but it can be overridden to process all points at once (e.g. with a single pass over the data).
+    /// NB: each point is counted as a function (and optionally as a gradient) evaluation.
+    ///
+    void evaluate(matrix_cmap_t xs, vector_map_t fxs, matrix_map_t gxs = {}) const;
+
     ///
     /// \brief returns the number of function evaluation calls registered so far.
     ///
@@ -198,9 +227,12 @@ protected:
     void convex(convexity);
     void smooth(smoothness);
     void strong_convexity(scalar_t);
+    void reentrant(bool);
 
     virtual string_t do_name() const;
     virtual scalar_t do_eval(eval_t) const = 0;
+    virtual void     do_hessian_vector(vector_cmap_t x, vector_cmap_t v, vector_map_t Hv) const;
+    virtual void     do_evaluate(matrix_cmap_t xs, vector_map_t fxs, matrix_map_t gxs) const;
 
 private:
     // attributes
@@ -208,6 +240,7 @@ private:
     convexity             m_convexity{convexity::no};   ///< whether the function is convex
     smoothness            m_smoothness{smoothness::no}; ///< whether the function is smooth
     scalar_t              m_strong_convexity{0};        ///< strong-convexity coefficient
+    bool                  m_reentrant{true};            ///< whether the function can be evaluated concurrently
     constraints_t         m_constraints;                ///< optional equality and inequality constraints
     mutable tensor_size_t m_fcalls{0};                  ///< number of function value evaluations
     mutable tensor_size_t m_gcalls{0};                  ///< number of function gradient evaluations
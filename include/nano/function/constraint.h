@@ -25,6 +25,13 @@ struct NANO_PUBLIC linear_t
     scalar_t m_r{0.0};
 };
 
+struct NANO_PUBLIC sparse_linear_t
+{
+    indices_t m_indices;
+    vector_t  m_values;
+    scalar_t  m_r{0.0};
+};
+
 struct NANO_PUBLIC quadratic_t
 {
     matrix_t m_P;
@@ -98,6 +105,24 @@ struct NANO_PUBLIC linear_inequality_t : linear_t
 {
 };
 
+///
+/// \brief equality constraint: h(x) = sum_k values(k) * x(indices(k)) + r = 0
+///
+/// NB: only the non-zero coefficients are stored, which is useful for large and sparse linear programs.
+///
+struct NANO_PUBLIC sparse_linear_equality_t : sparse_linear_t
+{
+};
+
+///
+/// \brief inequality constraint: g(x) = sum_k values(k) * x(indices(k)) + r <= 0
+///
+/// NB: only the non-zero coefficients are stored, which is useful for large and sparse linear programs.
+///
+struct NANO_PUBLIC sparse_linear_inequality_t : sparse_linear_t
+{
+};
+
 ///
 /// \brief equality constraint: h(x) = 1/2 * x.dot(P * x) + q.dot(x) + r = 0
 ///
@@ -141,6 +166,8 @@ using constraint_t = std::variant<constraint::constant_t,                  ///<
                                   constraint::euclidean_ball_inequality_t, ///<
                                   constraint::linear_equality_t,           ///<
                                   constraint::linear_inequality_t,         ///<
+                                  constraint::sparse_linear_equality_t,    ///<
+                                  constraint::sparse_linear_inequality_t,  ///<
                                   constraint::quadratic_equality_t,        ///<
                                   constraint::quadratic_inequality_t,      ///<
                                   constraint::functional_equality_t,       ///<
@@ -27,6 +27,7 @@ public:
         function_t::convex(convex);
         function_t::smooth(smooth);
         function_t::strong_convexity(strong_convexity);
+        function_t::reentrant(false);
     }
 
     ///
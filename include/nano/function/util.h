@@ -1,5 +1,6 @@
 #pragma once
 
+#include <Eigen/SparseCore>
 #include <nano/function.h>
 
 namespace nano
@@ -87,4 +88,24 @@ struct linear_constraints_t
 };
 
 NANO_PUBLIC std::optional<linear_constraints_t> make_linear_constraints(const function_t&);
+
+///
+/// \brief return a compact sparse linear representation (A, b, G, h) of the functional constraints (if possible):
+///     Ax = b (gathers all equality constraints) and
+///     Gx <= b (gathers all inequality constraints).
+///
+/// NB: if any constraint is not linear, then std::nullopt is returned.
+/// NB: only the non-zero coefficients are stored, so this is useful for large and sparse linear programs.
+///
+using sparse_matrix_t = Eigen::SparseMatrix<scalar_t>;
+
+struct sparse_linear_constraints_t
+{
+    sparse_matrix_t m_A; ///<
+    vector_t        m_b; ///<
+    sparse_matrix_t m_G; ///<
+    vector_t        m_h; ///<
+};
+
+NANO_PUBLIC std::optional<sparse_linear_constraints_t> make_sparse_linear_constraints(const function_t&);
 } // namespace nano
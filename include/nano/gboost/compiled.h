@@ -0,0 +1,97 @@
+#pragma once
+
+#include <nano/dataset.h>
+#include <nano/wlearner.h>
+
+namespace nano::gboost
+{
+///
+/// \brief flat representation of a fitted gradient boosting model useful for low-latency inference.
+///
+/// the decision stumps, the hinges, the affine functions and the decision trees are lowered into
+///     a structure-of-arrays of binary decision nodes with:
+///     - the index of the feature to evaluate (relative to the set of features used by the model),
+///     - the feature value threshold (the left child is taken if the feature value is smaller),
+///     - the offsets of the two children (positive for decision nodes and negative for leaves).
+///
+/// each leaf adds `weight * feature value + bias` to the predictions, where the feature value is the one
+///     evaluated by its parent decision node (the weight is zero for the leaves of stumps and trees).
+///
+/// the look-up tables of single-label categorical features are lowered into arrays mapping
+///     the label index to a leaf (with zero weight).
+///
+/// NB: the samples are scored in blocks of rows processed in parallel: the values of the used features
+///     are gathered once per block and then all the lowered weak learners are evaluated in one pass.
+/// NB: the missing feature values stop the evaluation of a weak learner (no contribution), like
+///     when calling the weak learner's predict.
+/// NB: the other weak learners (e.g. multi-label look-up tables) are kept as they are and evaluated separately.
+///
+class NANO_PUBLIC compiled_model_t
+{
+public:
+    ///
+    /// \brief default constructor
+    ///
+    compiled_model_t();
+
+    ///
+    /// \brief constructor (lower the given fitted bias and weak learners)
+    ///
+    compiled_model_t(const features_t& inputs, const tensor1d_t& bias, const rwlearners_t& wlearners);
+
+    ///
+    /// \brief evaluate the given samples and write the predictions in the given buffer.
+    ///
+    void predict(const dataset_t&, indices_cmap_t samples, tensor4d_map_t outputs) const;
+
+    ///
+    /// \brief evaluate the given rows of feature values and write the predictions in the given buffer.
+    ///
+    /// NB: the feature values are indexed as the input features (#rows, #inputs) and they are given:
+    ///     - as they are for the scalar features and
+    ///     - as label indices for the single-label categorical features.
+    /// NB: the not-finite values are interpreted as missing feature values.
+    /// NB: no allocation is performed and thus this is useful for low-latency scoring of a few rows,
+    ///     but it is supported only if all weak learners are lowered (see fallbacks()).
+    ///
+    void score(tensor2d_cmap_t rows, tensor4d_map_t outputs) const;
+
+    ///
+    /// \brief returns the number of lowered weak learners.
+    ///
+    tensor_size_t roots() const { return m_roots.size(); }
+
+    ///
+    /// \brief returns the number of lowered decision nodes.
+    ///
+    tensor_size_t nodes() const { return m_thresholds.size(); }
+
+    ///
+    /// \brief returns the number of lowered look-up tables.
+    ///
+    tensor_size_t lookups() const { return m_lfeatures.size(); }
+
+    ///
+    /// \brief returns the weak learners that cannot be lowered.
+    ///
+    const rwlearners_t& fallbacks() const { return m_fallbacks; }
+
+private:
+    template <class tvalues, class toutput>
+    void evaluate(const tvalues& values, toutput&& output) const;
+
+    // attributes
+    tensor1d_t   m_bias;       ///< fitted bias
+    indices_t    m_features;   ///< unique set of the features used by the decision nodes
+    indices_t    m_roots;      ///< decision node to start from for each lowered weak learner
+    indices_t    m_nfeatures;  ///< decision nodes: feature (column in the gathered feature values)
+    tensor1d_t   m_thresholds; ///< decision nodes: feature value threshold
+    indices_t    m_children;   ///< decision nodes: (left, right) child offsets (negative for leaves: -1 - leaf)
+    tensor2d_t   m_weights;    ///< leaves: weight of the parent's feature value (#leaves, #outputs)
+    tensor2d_t   m_biases;     ///< leaves: bias (#leaves, #outputs)
+    indices_t    m_lfeatures;  ///< look-up tables: feature (column in the gathered feature values)
+    indices_t    m_loffsets;   ///< look-up tables: offset of the first label in m_lleaves (#lookups + 1)
+    indices_t    m_lleaves;    ///< look-up tables: leaf offset for each label (negative: -1 - leaf)
+    rwlearners_t m_fallbacks;  ///< weak learners not lowered
+};
+} // namespace nano::gboost
@@ -38,15 +38,27 @@ public:
     ///
     /// \brief compute the gradient wrt output for each sample.
     ///
-    const tensor4d_t& gradients(const tensor4d_cmap_t& outputs) const;
+    /// NB: the diagonal of the hessian wrt output is computed as well only if requested (e.g. for Newton boosting).
+    ///     The memory usage is linear in the number of samples and in the target size in both cases.
+    ///
+    const tensor4d_t& gradients(const tensor4d_cmap_t& outputs, bool diag_hessians = false) const;
+
+    ///
+    /// \brief returns the diagonal of the hessian wrt output for each sample as computed by the last call
+    ///     to `gradients` with diagonal hessians requested: (#samples, dim1, dim2, dim3).
+    ///
+    const tensor4d_t& hessians() const { return m_vhdiags; }
 
 private:
+    using tensor7ds_t = std::vector<tensor7d_t>;
+
     // attributes
     const targets_iterator_t& m_iterator; ///<
     const loss_t&             m_loss;     ///<
     mutable tensor1d_t        m_values;   ///< loss values: (#samples,)
     mutable tensor4d_t        m_vgrads;   ///< loss gradients: (#samples, dim1, dim2, dim3)
-    mutable tensor7d_t        m_vhesss;   ///< loss hessians: (#samples, dim1, dim2, dim3, dim1, dim2, dim3)
+    mutable tensor4d_t        m_vhdiags;  ///< diagonal of the loss hessians: (#samples, dim1, dim2, dim3)
+    mutable tensor7ds_t       m_vhesss;   ///< per-thread loss hessians: (#batch, dim1, dim2, dim3, dim1, dim2, dim3)
 };
 
 ///
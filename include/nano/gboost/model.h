@@ -1,5 +1,6 @@
 #pragma once
 
+#include <nano/gboost/compiled.h>
 #include <nano/loss.h>
 #include <nano/machine/params.h>
 #include <nano/machine/result.h>
@@ -17,6 +18,7 @@ namespace nano
 ///         in a configurable number of boosting rounds.
 ///     - support for serialization of its parameters and the selected weak learners.
 ///     - training and evaluation is performed using all available threads.
+///     - the fitted model is lowered to a flat representation to speed-up inference (see gboost::compiled_model_t).
 ///     - the bias computation and the scaling of the weak learners can be solved
 ///         using any of the available builtin line-search-based solvers (e.g. lBFGS, CGD, CG_DESCENT).
 ///     - support for estimating the importance of the selected features.
@@ -74,6 +76,18 @@ public:
     ///
     ml::result_t fit(const dataset_t&, const indices_t&, const loss_t&, const ml::params_t& = {});
 
+    ///
+    /// \brief evaluate the given rows of feature values without building a dataset
+    ///     and write the predictions in the given buffer (#rows, target dimensions).
+    ///
+    /// NB: the feature values are indexed as the fitted input features (see learner_t::inputs()),
+    ///     thus the values of the features produced by the generators when fitting are expected
+    ///     (e.g. the original values for the identity generators).
+    /// NB: the single-label categorical features are given as label indices.
+    /// NB: no allocation is performed, which is useful for low-latency scoring of a few rows.
+    ///
+    void score(tensor2d_cmap_t rows, tensor4d_map_t outputs) const;
+
     ///
     /// \brief returns the selected features.
     ///
@@ -94,6 +108,11 @@ public:
     ///
     const rwlearners_t& prototypes() const { return m_prototypes; }
 
+    ///
+    /// \brief returns the flat representation of the fitted model used for inference.
+    ///
+    const gboost::compiled_model_t& compiled() const { return m_compiled; }
+
 private:
     ///
     /// \brief @see learner_t
@@ -101,8 +120,9 @@ private:
     void do_predict(const dataset_t&, indices_cmap_t, tensor4d_map_t) const override;
 
     // attributes
-    tensor1d_t   m_bias;       ///< fitted bias
-    rwlearners_t m_wlearners;  ///< fitted weak learners chosen from the prototypes
-    rwlearners_t m_prototypes; ///< prototype weak learners to fit from
+    tensor1d_t               m_bias;       ///< fitted bias
+    rwlearners_t             m_wlearners;  ///< fitted weak learners chosen from the prototypes
+    rwlearners_t             m_prototypes; ///< prototype weak learners to fit from
+    gboost::compiled_model_t m_compiled;   ///< flat representation of the fitted bias and weak learners
 };
 } // namespace nano
@@ -116,6 +116,17 @@ public:
     void select(indices_cmap_t samples, tensor_size_t feature, scalar_map_t) const;
     void select(indices_cmap_t samples, tensor_size_t feature, struct_map_t) const;
 
+    ///
+    /// \brief returns the values of the given scalar feature and samples as stored originally (without copying),
+    ///     useful for skipping the gathering and the conversion of the feature values in hot loops.
+    ///
+    /// NB: an empty view is returned if this is not possible (see scalar_view_t), e.g.:
+    ///     - the feature is transformed (not an identity feature), dropped or shuffled,
+    ///     - the feature has missing values or
+    ///     - the samples are not contiguous (e.g. all samples or a range of samples).
+    ///
+    scalar_view_t view(indices_cmap_t samples, tensor_size_t feature) const;
+
     ///
     /// \brief computes the values of all features for the given samples,
     ///     useful for training and evaluating ML model that map densely continuous inputs to targets
@@ -137,6 +148,10 @@ protected:
     virtual void do_select(indices_cmap_t samples, tensor_size_t feature, scalar_map_t) const = 0;
     virtual void do_select(indices_cmap_t samples, tensor_size_t feature, struct_map_t) const = 0;
 
+    virtual scalar_view_t do_view(indices_cmap_t samples, tensor_size_t feature) const;
+
+    static bool contiguous(indices_cmap_t samples);
+
     template <size_t input_rank1, class toperator>
     void iterate(const indices_cmap_t& samples, const tensor_size_t ifeature, const tensor_size_t ioriginal,
                  const toperator& op) const
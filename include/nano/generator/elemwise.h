@@ -75,6 +75,37 @@ public:
         }
     }
 
+    ///
+    /// \brief @see generator_t
+    ///
+    scalar_view_t do_view([[maybe_unused]] indices_cmap_t samples,
+                          [[maybe_unused]] const tensor_size_t ifeature) const override
+    {
+        if constexpr (tcomputer::generated_type == generator_type::scalar && tcomputer::identity)
+        {
+            const auto& datasource = this->datasource();
+            return datasource.visit_inputs(
+                this->mapped_original(ifeature),
+                [&](const feature_t& feature, const auto& data, const auto& mask)
+                {
+                    if constexpr (std::remove_reference_t<decltype(data)>::rank() == 4U)
+                    {
+                        if (feature.is_scalar() && !optional(mask, datasource.samples()))
+                        {
+                            const auto begin = samples(0);
+                            const auto end   = samples(samples.size() - 1) + 1;
+                            return scalar_view_t{data.reshape(-1).slice(begin, end)};
+                        }
+                    }
+                    return scalar_view_t{};
+                });
+        }
+        else
+        {
+            return scalar_view_t{};
+        }
+    }
+
     ///
     /// \brief @see generator_t
     ///
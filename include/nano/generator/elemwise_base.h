@@ -10,6 +10,11 @@ namespace nano
 class NANO_PUBLIC base_elemwise_generator_t : public generator_t
 {
 public:
+    ///
+    /// \brief true if the original feature values are forwarded as they are (see generator_t::view).
+    ///
+    static constexpr auto identity = false;
+
     ///
     /// \brief default constructor (use all available features).
     ///
@@ -63,6 +63,8 @@ private:
 class NANO_PUBLIC scalar_identity_t : public elemwise_input_scalar_t, public generated_scalar_t
 {
 public:
+    static constexpr auto identity = true;
+
     template <class... targs>
     explicit scalar_identity_t(targs&&... args)
         : elemwise_input_scalar_t("identity-scalar", std::forward<targs>(args)...)
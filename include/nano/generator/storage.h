@@ -2,6 +2,7 @@
 
 #include <nano/scalar.h>
 #include <nano/tensor/tensor.h>
+#include <variant>
 
 namespace nano
 {
@@ -23,6 +24,14 @@ using scalar_mem_t  = tensor_mem_t<scalar_t, 1>;
 using scalar_map_t  = tensor_map_t<scalar_t, 1>;
 using scalar_cmap_t = tensor_cmap_t<scalar_t, 1>;
 
+// scalar continuous feature values as stored originally (without copying): (sample index) = scalar feature value
+// NB: the view is empty (std::monostate) if the feature values cannot be mapped directly to the original storage.
+using scalar_view_t =
+    std::variant<std::monostate, tensor_cmap_t<int8_t, 1>, tensor_cmap_t<int16_t, 1>, tensor_cmap_t<int32_t, 1>,
+                 tensor_cmap_t<int64_t, 1>, tensor_cmap_t<uint8_t, 1>, tensor_cmap_t<uint16_t, 1>,
+                 tensor_cmap_t<uint32_t, 1>, tensor_cmap_t<uint64_t, 1>, tensor_cmap_t<float, 1>,
+                 tensor_cmap_t<double, 1>>;
+
 // structured continuous feature values: (sample index, dim1, dim2, dim3)
 // NB: any not-finite value imply missing feature values.
 using struct_mem_t  = tensor_mem_t<scalar_t, 4>;
@@ -34,6 +34,11 @@ public:
     ///
     void critical_compatible(const dataset_t&) const;
 
+    ///
+    /// \brief returns the input features of the fitted dataset.
+    ///
+    const features_t& inputs() const { return m_inputs; }
+
     ///
     /// \brief compute the predictions for the given samples in the given output buffer.
     ///
@@ -24,6 +24,9 @@ using rlinear_t = std::unique_ptr<linear_t>;
 ///     - regression (both univariate and multivariate) depending on the chosen loss function.
 ///
 /// NB: the inputs should be normalized during training to speed-up convergence (@see nano::scaling_type).
+/// NB: the inputs can be processed in single precision to reduce memory usage (@see nano::precision_type).
+/// NB: the inputs are cached once and shared across the folds and the trials of the hyper-parameter tuning.
+/// NB: the one-hot encoded categorical inputs are stored sparsely if this reduces the memory usage significantly.
 ///
 /// see "Regression Shrinkage and Selection via the lasso", by R. Tibshirani
 /// see "Regularization and variable selection via the elastic net", by H. Zou, T. Hastie
@@ -58,6 +61,16 @@ public:
     ///
     ml::result_t fit(const dataset_t&, const indices_t&, const loss_t&, const ml::params_t& = {});
 
+    ///
+    /// \brief evaluate the given rows of flatten feature values without building a dataset
+    ///     and write the predictions in the given buffer (#rows, target dimensions).
+    ///
+    /// NB: the feature values are expected as produced by dataset_t::flatten (e.g. one-hot encoded categorical
+    ///     features), thus with the values of the features produced by the generators when fitting.
+    /// NB: no allocation is performed, which is useful for low-latency scoring of a few rows.
+    ///
+    void score(tensor2d_cmap_t rows, tensor4d_map_t outputs) const;
+
     ///
     /// \brief returns the fitted bias vector (intercept).
     ///
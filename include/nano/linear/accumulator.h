@@ -21,6 +21,13 @@ public:
     ///
     accumulator_t(tensor_size_t isize, tensor_size_t tsize);
 
+    ///
+    /// \brief allocate (or release) the buffers used to cumulate the Hessian.
+    ///
+    /// NB: the Hessian buffers are quadratic in the number of parameters, so they are allocated only if needed.
+    ///
+    void hessian(bool enable);
+
     ///
     /// \brief reset the accumulator.
     ///
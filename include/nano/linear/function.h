@@ -16,6 +16,10 @@ namespace nano::linear
 ///     - (2) the L2-norm of the weights matrix - like in RIDGE
 ///     - (3) both the L1 and the L2-norms of the weights matrix - like in elastic net regularization
 ///
+/// NB: the flatten feature values are processed using the hybrid dense-sparse representation
+///     if cached this way (see flatten_iterator_t::cache_sparse), so that the cost scales with the number of
+///     non-default one-hot encoded values of the categorical features.
+///
 class NANO_PUBLIC function_t final : public ::nano::function_t
 {
 public:
@@ -68,6 +72,22 @@ public:
     ///
     scalar_t do_eval(eval_t) const override;
 
+    ///
+    /// \brief @see function_t
+    ///
+    /// NB: the Hessian-vector product is computed efficiently without forming the Hessian:
+    ///     it costs about as much as a gradient evaluation and it needs no quadratic memory.
+    ///
+    void do_hessian_vector(vector_cmap_t x, vector_cmap_t v, vector_map_t Hv) const override;
+
+    ///
+    /// \brief @see function_t
+    ///
+    /// NB: all points are evaluated with a single pass over the data
+    ///     by stacking their weights (one matrix-matrix product per batch of samples).
+    ///
+    void do_evaluate(matrix_cmap_t xs, vector_map_t fxs, matrix_map_t gxs) const override;
+
 private:
     // attributes
     const flatten_iterator_t& m_iterator;     ///<
@@ -77,5 +97,7 @@ private:
     tensor_size_t             m_isize{0};     ///< #inputs (e.g. size of the flatten input feature tensor)
     tensor_size_t             m_tsize{0};     ///< #targets (e.g. size of the flatten target tensor, number of classes)
     mutable accumulators_t    m_accumulators; ///< liner model-specific buffers per thread
+    mutable flatten32_t       m_weights32;    ///< single precision weights (see flatten_iterator_t::precision)
+    mutable flatten32_t       m_vweights32;   ///< single precision weights of the Hessian-vector product's vector
 };
 } // namespace nano::linear
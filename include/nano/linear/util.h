@@ -18,6 +18,26 @@ NANO_PUBLIC void predict(const tensor2d_cmap_t& inputs, const tensor2d_cmap_t& w
 NANO_PUBLIC void predict(const tensor2d_cmap_t& inputs, const tensor2d_cmap_t& weights, const tensor1d_cmap_t& bias,
                          tensor4d_t& outputs);
 
+///
+/// \brief compute the predictions of the linear model with the given weights and bias
+///     using single precision inputs and weights (the predictions are in double precision).
+///
+NANO_PUBLIC void predict(const tensor_cmap_t<float, 2>& inputs, const tensor_cmap_t<float, 2>& weights,
+                         const tensor1d_cmap_t& bias, tensor4d_map_t outputs);
+
+NANO_PUBLIC void predict(const tensor_cmap_t<float, 2>& inputs, const tensor_cmap_t<float, 2>& weights,
+                         const tensor1d_cmap_t& bias, tensor4d_t& outputs);
+
+///
+/// \brief compute the predictions of the linear model with the given weights and bias
+///     using flatten feature values stored with the hybrid dense-sparse representation (see sparse_flatten_t).
+///
+NANO_PUBLIC void predict(const sparse_flatten_t& inputs, const tensor2d_cmap_t& weights, const tensor1d_cmap_t& bias,
+                         tensor4d_map_t outputs);
+
+NANO_PUBLIC void predict(const sparse_flatten_t& inputs, const tensor2d_cmap_t& weights, const tensor1d_cmap_t& bias,
+                         tensor4d_t& outputs);
+
 ///
 /// \brief evaluate the predictions of the linear model with the given weights and bias
 ///     against the ground truth and return the errors and loss values.
@@ -54,6 +54,25 @@ public:
     void vgrad(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor4d_t& vgrads) const;
     void vhess(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor7d_t& vhesss) const;
 
+    ///
+    /// \brief compute any combination of the loss value, gradient and hessian for each sample in a single pass
+    ///     given the targets (the ground truth) and the outputs (the predictions).
+    ///
+    /// NB: the empty buffers are skipped, so that only the requested quantities are computed.
+    /// NB: this is faster than calling `value`, `vgrad` and `vhess` one after the other
+    ///     as the intermediate results (e.g. exponentials, logarithms) are shared for each sample.
+    ///
+    void eval(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor1d_map_t values,
+              tensor4d_map_t vgrads = tensor4d_map_t{}, tensor7d_map_t vhesss = tensor7d_map_t{}) const;
+
+    ///
+    /// \brief overload to simplify usage.
+    ///
+    /// NB: the output tensors are allocated accordingly and the gradients and the hessians are optional.
+    ///
+    void eval(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor1d_t& values, tensor4d_t* vgrads = nullptr,
+              tensor7d_t* vhesss = nullptr) const;
+
     ///
     /// \brief returns whether the loss function is convex.
     ///
@@ -82,6 +101,8 @@ protected:
     virtual void do_value(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor1d_map_t) const = 0;
     virtual void do_vgrad(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor4d_map_t) const = 0;
     virtual void do_vhess(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor7d_map_t) const = 0;
+    virtual void do_eval(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor1d_map_t, tensor4d_map_t,
+                         tensor7d_map_t) const;
 
 private:
     // attributes
@@ -36,5 +36,29 @@ struct cauchy_t : public terror
 
         vhess = ((1.0 - delta2) / (1.0 + delta2).square()).matrix().asDiagonal();
     }
+
+    template <class tarray, class tgarray, class thmatrix>
+    requires(is_eigen_v<tarray> && is_eigen_v<tgarray> && is_eigen_v<thmatrix>)
+    static auto eval(const tarray& target, const tarray& output, tgarray vgrad, thmatrix vhess)
+    {
+        if (vgrad.size() == 0)
+        {
+            if (vhess.size() > 0)
+            {
+                cauchy_t::vhess(target, output, vhess);
+            }
+            return cauchy_t::value(target, output);
+        }
+
+        vgrad = output - target;
+
+        const auto value = 0.5 * vgrad.square().log1p().sum();
+        if (vhess.size() > 0)
+        {
+            vhess = ((1.0 - vgrad.square()) / (1.0 + vgrad.square()).square()).matrix().asDiagonal();
+        }
+        vgrad /= 1.0 + vgrad.square();
+        return value;
+    }
 };
 } // namespace nano::detail
@@ -49,5 +49,34 @@ struct classnll_t : public terror
         vhess = -coef.matrix() * coef.matrix().transpose();
         vhess.diagonal().array() += coef;
     }
+
+    template <class tarray, class tgarray, class thmatrix>
+    requires(is_eigen_v<tarray> && is_eigen_v<tgarray> && is_eigen_v<thmatrix>)
+    static auto eval(const tarray& target, const tarray& output, tgarray vgrad, thmatrix vhess)
+    {
+        if (vgrad.size() == 0)
+        {
+            if (vhess.size() > 0)
+            {
+                classnll_t::vhess(target, output, vhess);
+            }
+            return classnll_t::value(target, output);
+        }
+
+        auto       imax = tensor_size_t{0};
+        const auto omax = output.maxCoeff(&imax);
+
+        vgrad = (output - omax).exp();
+
+        const auto sum = vgrad.sum();
+        vgrad /= sum;
+        if (vhess.size() > 0)
+        {
+            vhess = -vgrad.matrix() * vgrad.matrix().transpose();
+            vhess.diagonal().array() += vgrad;
+        }
+        vgrad -= 0.5 * (1.0 + target);
+        return std::log(sum) - 0.5 * ((1.0 + target) * output).sum() + omax;
+    }
 };
 } // namespace nano::detail
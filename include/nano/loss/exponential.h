@@ -34,5 +34,29 @@ struct exponential_t : public terror
     {
         vhess = (-target * output).exp().matrix().asDiagonal();
     }
+
+    template <class tarray, class tgarray, class thmatrix>
+    requires(is_eigen_v<tarray> && is_eigen_v<tgarray> && is_eigen_v<thmatrix>)
+    static auto eval(const tarray& target, const tarray& output, tgarray vgrad, thmatrix vhess)
+    {
+        if (vgrad.size() == 0)
+        {
+            if (vhess.size() > 0)
+            {
+                exponential_t::vhess(target, output, vhess);
+            }
+            return exponential_t::value(target, output);
+        }
+
+        vgrad = (-target * output).exp();
+
+        const auto value = vgrad.sum();
+        if (vhess.size() > 0)
+        {
+            vhess = vgrad.matrix().asDiagonal();
+        }
+        vgrad *= -target;
+        return value;
+    }
 };
 } // namespace nano::detail
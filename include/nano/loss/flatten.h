@@ -97,6 +97,54 @@ public:
             tloss::vhess(targets.array(i), outputs.array(i), vhesss.tensor(i).reshape(tsize, tsize).matrix());
         }
     }
+
+    ///
+    /// \brief @see loss_t
+    ///
+    void do_eval(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor1d_map_t values, tensor4d_map_t vgrads,
+                 tensor7d_map_t vhesss) const override
+    {
+        const auto tsize = targets.size<1>() * targets.size<2>() * targets.size<3>();
+
+        const auto has_value = values.size() > 0;
+        const auto has_vgrad = vgrads.size() > 0;
+        const auto has_vhess = vhesss.size() > 0;
+
+        for (tensor_size_t i = 0, samples = targets.size<0>(); i < samples; ++i)
+        {
+            const auto target = targets.array(i);
+            const auto output = outputs.array(i);
+
+            auto vgrad = map_vector(has_vgrad ? vgrads.data() + i * tsize : nullptr, has_vgrad ? tsize : 0).array();
+            auto vhess = map_matrix(has_vhess ? vhesss.data() + i * tsize * tsize : nullptr, has_vhess ? tsize : 0,
+                                    has_vhess ? tsize : 0);
+
+            if constexpr (requires { tloss::eval(target, output, vgrad, vhess); })
+            {
+                // fused evaluation: the intermediate results are shared
+                const auto value = tloss::eval(target, output, vgrad, vhess);
+                if (has_value)
+                {
+                    values(i) = value;
+                }
+            }
+            else
+            {
+                if (has_value)
+                {
+                    values(i) = tloss::value(target, output);
+                }
+                if (has_vgrad)
+                {
+                    tloss::vgrad(target, output, vgrad);
+                }
+                if (has_vhess)
+                {
+                    tloss::vhess(target, output, vhess);
+                }
+            }
+        }
+    }
 };
 
 // regression
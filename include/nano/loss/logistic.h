@@ -52,5 +52,40 @@ struct logistic_t : public terror
             vhess(i, i) = h;
         }
     }
+
+    template <class tarray, class tgarray, class thmatrix>
+    requires(is_eigen_v<tarray> && is_eigen_v<tgarray> && is_eigen_v<thmatrix>)
+    static auto eval(const tarray& target, const tarray& output, tgarray vgrad, thmatrix vhess)
+    {
+        if (vgrad.size() == 0)
+        {
+            if (vhess.size() > 0)
+            {
+                logistic_t::vhess(target, output, vhess);
+            }
+            return logistic_t::value(target, output);
+        }
+
+        if (vhess.size() > 0)
+        {
+            vhess.fill(0.0);
+        }
+
+        scalar_t value = 0.0;
+        for (tensor_size_t i = 0, size = target.size(); i < size; ++i)
+        {
+            const auto x = -target(i) * output(i);
+            const auto e = std::exp(-std::fabs(x));
+            const auto p = 1.0 / (1.0 + e);
+
+            value += std::max(x, 0.0) + std::log1p(e);
+            vgrad(i) = -target(i) * ((x < 0.0) ? (e * p) : p);
+            if (vhess.size() > 0)
+            {
+                vhess(i, i) = e * p * p;
+            }
+        }
+        return value;
+    }
 };
 } // namespace nano::detail
@@ -42,5 +42,29 @@ struct savage_t : public terror
 
         vhess = ((4.0 - 2.0 * eneg) / (2.0 + epos + eneg).square()).matrix().asDiagonal();
     }
+
+    template <class tarray, class tgarray, class thmatrix>
+    requires(is_eigen_v<tarray> && is_eigen_v<tgarray> && is_eigen_v<thmatrix>)
+    static auto eval(const tarray& target, const tarray& output, tgarray vgrad, thmatrix vhess)
+    {
+        if (vgrad.size() == 0)
+        {
+            if (vhess.size() > 0)
+            {
+                savage_t::vhess(target, output, vhess);
+            }
+            return savage_t::value(target, output);
+        }
+
+        vgrad = (target * output).exp();
+
+        const auto value = (1.0 / (1.0 + vgrad).square()).sum();
+        if (vhess.size() > 0)
+        {
+            vhess = ((4.0 - 2.0 / vgrad) / (2.0 + vgrad + 1.0 / vgrad).square()).matrix().asDiagonal();
+        }
+        vgrad = -2.0 * target / ((1.0 + vgrad) * (2.0 + vgrad + 1.0 / vgrad));
+        return value;
+    }
 };
 } // namespace nano::detail
@@ -42,5 +42,30 @@ struct tangent_t : public terror
 
         vhess = (8.0 * target * target * (1.0 - output * target * atan) / gdiv.square()).matrix().asDiagonal();
     }
+
+    template <class tarray, class tgarray, class thmatrix>
+    requires(is_eigen_v<tarray> && is_eigen_v<tgarray> && is_eigen_v<thmatrix>)
+    static auto eval(const tarray& target, const tarray& output, tgarray vgrad, thmatrix vhess)
+    {
+        if (vgrad.size() == 0)
+        {
+            if (vhess.size() > 0)
+            {
+                tangent_t::vhess(target, output, vhess);
+            }
+            return tangent_t::value(target, output);
+        }
+
+        vgrad = 2.0 * (target * output).atan() - 1.0;
+
+        const auto value = vgrad.square().sum();
+        const auto gdiv  = 1.0 + (target * output).square();
+        if (vhess.size() > 0)
+        {
+            vhess = (8.0 * target * target * (1.0 - output * target * vgrad) / gdiv.square()).matrix().asDiagonal();
+        }
+        vgrad = 4.0 * target * vgrad / gdiv;
+        return value;
+    }
 };
 } // namespace nano::detail
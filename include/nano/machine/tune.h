@@ -1,5 +1,6 @@
 #pragma once
 
+#include <nano/core/parallel.h>
 #include <nano/machine/params.h>
 #include <nano/machine/result.h>
 
@@ -18,7 +19,9 @@ using tune_callback_t = std::function<std::tuple<tensor2d_t, tensor2d_t, std::an
 ///
 /// NB: each set of hyper-parameter values is evaluated using the given callback.
 /// NB: the tuning is performed in parallel across the current set of hyper-parameter values to evaluate and the folds.
+/// NB: the callback should submit its parallel work (e.g. by using a dataset) to the same scheduler
+///     to avoid oversubscribing the available cores.
 ///
 NANO_PUBLIC result_t tune(const string_t& prefix, const indices_t& samples, const params_t&, param_spaces_t,
-                          const tune_callback_t&);
+                          const tune_callback_t&, parallel::scheduler_t& = parallel::scheduler_t::shared());
 } // namespace nano::ml
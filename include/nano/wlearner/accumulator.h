@@ -62,6 +62,16 @@ public:
         rx(bin) -= vgrad * value;
     }
 
+    ///
+    /// \brief accumulate the statistics of the given bin of another accumulator (e.g. to scan histograms).
+    ///
+    void update(const accumulator_t& other, tensor_size_t other_bin, tensor_size_t bin = 0);
+
+    ///
+    /// \brief remove the statistics of another accumulator with the same number of bins (e.g. to subtract histograms).
+    ///
+    void subtract(const accumulator_t& other);
+
     std::vector<std::pair<scalar_t, tensor_size_t>> sort() const;
 
     std::tuple<tensor2d_t, tensor5d_t, tensor5d_t, tensor5d_t, tensor_mem_t<tensor_size_t, 2>> cluster() const;
@@ -34,6 +34,9 @@ NANO_PUBLIC std::ostream& write(std::ostream&, const dtree_node_t&);
 ///     decision stumps (for continuous scalar features only).
 ///
 /// NB: structured and discrete features are skipped during fiting.
+/// NB: if the features are quantized (see the `wlearner::bins` parameter), then the tree is grown level-wise:
+///     the nodes at the same depth are fitted in parallel and the per-bin statistics are computed
+///     only for the smaller child of each split (the other child's are obtained by subtraction from the parent's).
 ///
 class NANO_PUBLIC dtree_wlearner_t final : public wlearner_t
 {
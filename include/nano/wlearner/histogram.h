@@ -0,0 +1,62 @@
+#pragma once
+
+#include <nano/dataset/quantize.h>
+#include <nano/wlearner/accumulator.h>
+#include <nano/wlearner/criterion.h>
+
+namespace nano::wlearner
+{
+///
+/// \brief per-bin statistics of the gradients for a quantized feature (see quantized_features_t),
+///     useful for fitting decision stumps by scanning the bins instead of sorting the feature values.
+///
+/// NB: the histogram of a set of samples can be obtained by subtracting the histograms of the
+///     complementary samples, like the histogram of a child node from its parent's and its sibling's.
+///
+class NANO_PUBLIC histogram_t
+{
+public:
+    using codes_cmap_t = quantized_features_t::codes_cmap_t;
+
+    explicit histogram_t(const tensor3d_dims_t& tdims = make_dims(0, 0, 0));
+
+    auto bins() const { return m_acc_bin.bins(); }
+
+    auto missing_rss() const { return m_missing_rss; }
+
+    auto missing_cnt() const { return m_missing_cnt; }
+
+    const auto& tables() const { return m_tables; }
+
+    void clear(tensor_size_t bins);
+
+    ///
+    /// \brief accumulate the gradients of the given samples using their bin codes.
+    ///
+    void update(const tensor4d_t& gradients, codes_cmap_t codes, const indices_t& samples);
+
+    ///
+    /// \brief remove the statistics of the given histogram (e.g. built with a subset of the samples).
+    ///
+    void subtract(const histogram_t& other);
+
+    ///
+    /// \brief returns the score and the bin of the best split of the form (bin code <= bin) as a decision stump.
+    ///
+    /// NB: the score is `wlearner_t::no_fit_score()` if no valid split is found.
+    /// NB: the associated decision stump's tables are available with `tables()`.
+    ///
+    std::tuple<scalar_t, tensor_size_t> fit(wlearner_criterion criterion);
+
+private:
+    // attributes
+    accumulator_t m_acc_bin;        ///< per-bin statistics
+    accumulator_t m_acc_sum;        ///< (buffer) statistics of all bins
+    accumulator_t m_acc_neg;        ///< (buffer) statistics of the bins to the left of the threshold
+    tensor4d_t    m_tables;         ///< (2, #outputs) - decision stump's tables of the best split
+    scalar_t      m_missing_rss{0}; ///< residual sum of squares of the samples with missing feature values
+    scalar_t      m_missing_cnt{0}; ///< number of samples with missing feature values
+};
+
+using histograms_t = std::vector<histogram_t>;
+} // namespace nano::wlearner
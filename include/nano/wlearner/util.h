@@ -23,18 +23,21 @@ NANO_PUBLIC rwlearners_t clone(const rwlearners_t&);
 ///
 /// \brief loop over the feature values of the given scalar feature and samples.
 ///
+/// NB: the operator is called concurrently for distinct samples (see select_iterator_t),
+///     so it should only update per-sample state: op(sample index, feature value).
+///
 template <class toperator>
 void loop_scalar(const dataset_t& dataset, const indices_t& samples, const tensor_size_t feature, const toperator& op)
 {
     const auto iterator = select_iterator_t{dataset};
     iterator.loop(samples, feature,
-                  [&](tensor_size_t, size_t, const scalar_cmap_t& fvalues)
+                  [&](const tensor_range_t& range, size_t, const scalar_cmap_t& fvalues)
                   {
-                      for (tensor_size_t i = 0; i < samples.size(); ++i)
+                      for (tensor_size_t i = 0; i < fvalues.size(); ++i)
                       {
                           if (const auto value = fvalues(i); std::isfinite(value))
                           {
-                              op(i, fvalues(i));
+                              op(range.begin() + i, value);
                           }
                       }
                   });
@@ -48,13 +51,13 @@ void loop_sclass(const dataset_t& dataset, const indices_t& samples, const tenso
 {
     const auto iterator = select_iterator_t{dataset};
     iterator.loop(samples, feature,
-                  [&](tensor_size_t, size_t, const sclass_cmap_t& fvalues)
+                  [&](const tensor_range_t& range, size_t, const sclass_cmap_t& fvalues)
                   {
-                      for (tensor_size_t i = 0; i < samples.size(); ++i)
+                      for (tensor_size_t i = 0; i < fvalues.size(); ++i)
                       {
                           if (const auto value = fvalues(i); value >= 0)
                           {
-                              op(i, value);
+                              op(range.begin() + i, value);
                           }
                       }
                   });
@@ -68,13 +71,13 @@ void loop_mclass(const dataset_t& dataset, const indices_t& samples, const tenso
 {
     const auto iterator = select_iterator_t{dataset};
     iterator.loop(samples, feature,
-                  [&](tensor_size_t, size_t, const mclass_cmap_t& fvalues)
+                  [&](const tensor_range_t& range, size_t, const mclass_cmap_t& fvalues)
                   {
-                      for (tensor_size_t i = 0; i < samples.size(); ++i)
+                      for (tensor_size_t i = 0; i < fvalues.size<0>(); ++i)
                       {
                           if (const auto values = fvalues.vector(i); values(0) >= 0)
                           {
-                              op(i, values);
+                              op(range.begin() + i, values);
                           }
                       }
                   });
@@ -94,3 +94,240 @@ pool_t::~pool_t()
         thread.join();
     }
 }
+
+namespace
+{
+thread_local const scheduler_t* t_scheduler = nullptr; ///< scheduler owning the current worker thread (if any)
+thread_local size_t             t_tnum      = 0U;      ///< index of the current worker thread
+} // namespace
+
+void scheduler_t::job_t::operator()(const size_t begin, const size_t end, const size_t tnum)
+{
+    try
+    {
+        m_invoke(m_callback, begin, end, tnum);
+    }
+    catch (...)
+    {
+        const std::scoped_lock lock(m_mutex);
+        if (!m_exception)
+        {
+            m_exception = std::current_exception();
+        }
+    }
+}
+
+scheduler_t::scheduler_t()
+    : scheduler_t(pool_t::max_size())
+{
+}
+
+scheduler_t::scheduler_t(const size_t threads)
+{
+    const auto n_workers = std::clamp(threads, size_t(1), pool_t::max_size());
+
+    m_deques.reserve(n_workers);
+    for (size_t tnum = 0; tnum < n_workers; ++tnum)
+    {
+        m_deques.emplace_back(std::make_unique<deque_t>());
+    }
+
+    m_threads.reserve(n_workers);
+    for (size_t tnum = 0; tnum < n_workers; ++tnum)
+    {
+        m_threads.emplace_back([this, tnum]() { work(tnum); });
+    }
+}
+
+scheduler_t& scheduler_t::shared()
+{
+    static scheduler_t scheduler;
+    return scheduler;
+}
+
+scheduler_t::~scheduler_t()
+{
+    {
+        const std::scoped_lock lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+void scheduler_t::run(job_t& job, const bool raise)
+{
+    const auto elements = job.m_elements;
+    const auto grain    = job.m_grain;
+
+    if (elements == 0U)
+    {
+        return;
+    }
+
+    // nested call from a worker thread: process the ranges of this job while the idle workers can steal them
+    if (t_scheduler == this)
+    {
+        const auto tnum = t_tnum;
+        if (elements <= grain || size() == 1U)
+        {
+            job(0U, elements, tnum);
+        }
+        else
+        {
+            push(tnum, range_t{&job, 0U, elements});
+
+            range_t range;
+            while (!job.done())
+            {
+                if (pop(tnum, &job, range) || steal(tnum, &job, range))
+                {
+                    process(tnum, range);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
+
+    // call from an external thread (or not worth parallelizing): process the ranges in place
+    else if (elements <= grain || size() == 1U)
+    {
+        job(0U, elements, 0U);
+    }
+
+    // call from an external thread: distribute the ranges to all workers and wait for them to finish
+    else
+    {
+        const auto chunks = (elements + grain - 1U) / grain;
+        const auto stride = grain * ((chunks + size() - 1U) / size());
+        for (size_t tnum = 0U, begin = 0U; begin < elements; ++tnum, begin += stride)
+        {
+            push(tnum, range_t{&job, begin, std::min(begin + stride, elements)});
+        }
+
+        std::unique_lock lock(m_mutex);
+        m_finished.wait(lock, [&] { return job.done(); });
+    }
+
+    if (raise && job.m_exception)
+    {
+        std::rethrow_exception(job.m_exception);
+    }
+}
+
+void scheduler_t::push(const size_t tnum, const range_t& range)
+{
+    {
+        auto& deque = *m_deques[tnum];
+
+        const std::scoped_lock lock(deque.m_mutex);
+        deque.m_ranges.push_back(range);
+    }
+
+    m_queued.fetch_add(1U);
+    if (m_sleeping.load() > 0U)
+    {
+        {
+            const std::scoped_lock lock(m_mutex);
+        }
+        m_condition.notify_one();
+    }
+}
+
+bool scheduler_t::pop(const size_t tnum, const job_t* job, range_t& range)
+{
+    auto& deque = *m_deques[tnum];
+
+    const std::scoped_lock lock(deque.m_mutex);
+    if (deque.m_ranges.empty() || (job != nullptr && deque.m_ranges.back().m_job != job))
+    {
+        return false;
+    }
+
+    range = deque.m_ranges.back();
+    deque.m_ranges.pop_back();
+    m_queued.fetch_sub(1U);
+    return true;
+}
+
+bool scheduler_t::steal(const size_t tnum, const job_t* job, range_t& range)
+{
+    for (size_t offset = 1U; offset < size(); ++offset)
+    {
+        auto& deque = *m_deques[(tnum + offset) % size()];
+
+        const std::scoped_lock lock(deque.m_mutex);
+        for (auto it = deque.m_ranges.begin(); it != deque.m_ranges.end(); ++it)
+        {
+            if (job == nullptr || it->m_job == job)
+            {
+                range = *it;
+                deque.m_ranges.erase(it);
+                m_queued.fetch_sub(1U);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void scheduler_t::process(const size_t tnum, range_t range)
+{
+    auto& job = *range.m_job;
+
+    // split the range in halves (aligned to the grain size) and make the second half available for stealing
+    while (range.m_end - range.m_begin > job.m_grain)
+    {
+        const auto chunks = (range.m_end - range.m_begin + job.m_grain - 1U) / job.m_grain;
+        const auto middle = range.m_begin + job.m_grain * (chunks / 2U);
+
+        push(tnum, range_t{&job, middle, range.m_end});
+        range.m_end = middle;
+    }
+
+    const auto elements = range.m_end - range.m_begin;
+    job(range.m_begin, range.m_end, tnum);
+
+    // NB: the job may be destroyed by its owner as soon as all its elements are processed!
+    if (job.m_pending.fetch_sub(elements) == elements)
+    {
+        {
+            const std::scoped_lock lock(m_mutex);
+        }
+        m_finished.notify_all();
+    }
+}
+
+void scheduler_t::work(const size_t tnum)
+{
+    t_scheduler = this;
+    t_tnum      = tnum;
+
+    while (true)
+    {
+        range_t range;
+        if (pop(tnum, nullptr, range) || steal(tnum, nullptr, range))
+        {
+            process(tnum, range);
+            continue;
+        }
+
+        std::unique_lock lock(m_mutex);
+        m_sleeping.fetch_add(1U);
+        m_condition.wait(lock, [&] { return m_stop || m_queued.load() > 0U; });
+        m_sleeping.fetch_sub(1U);
+
+        if (m_stop)
+        {
+            break;
+        }
+    }
+}
@@ -58,7 +58,11 @@ auto resize_and_map(tensor_mem_t<tscalar, trank>& buffer, tindices... dims)
 
 dataset_t::dataset_t(const datasource_t& datasource, const size_t threads)
     : m_datasource(datasource)
-    , m_pool(std::make_unique<parallel::pool_t>(threads))
+    , m_owned_pool(threads < parallel::scheduler_t::shared().size()
+                       ? std::make_unique<parallel::scheduler_t>(threads)
+                       : nullptr)
+    , m_pool(m_owned_pool ? m_owned_pool.get() : &parallel::scheduler_t::shared())
+    , m_cache(std::make_unique<cache_t>())
 {
     if (m_datasource.type() != task_type::unsupervised)
     {
@@ -75,6 +79,7 @@ dataset_t& dataset_t::add(rgenerator_t&& generator)
     generator->fit(m_datasource);
     m_generators.emplace_back(std::move(generator));
     update();
+    uncache();
 
     const auto elapsed = timer.elapsed();
     log(log_type::info, "dataset: loaded feature generator '", genid, "' in <", elapsed, ">.\n");
@@ -110,7 +115,7 @@ void dataset_t::update()
 
     m_column_mapping.resize(total_columns, 3);
     m_feature_mapping.resize(features, 5);
-    m_generator_mapping.resize(generators, 1);
+    m_generator_mapping.resize(generators, 2);
 
     tensor_size_t index           = 0;
     tensor_size_t offset_columns  = 0;
@@ -156,8 +161,63 @@ void dataset_t::update()
             }
         }
 
-        m_generator_mapping(index++, 0) = offset_columns - old_offset_columns;
+        const auto categorical = [&](const tensor_size_t ifeature)
+        {
+            const auto feature = generator->feature(ifeature);
+            return feature.type() == feature_type::sclass || feature.type() == feature_type::mclass;
+        };
+
+        auto sparse = generator->features() > 0;
+        for (tensor_size_t ifeature = 0; ifeature < generator->features() && sparse; ++ifeature)
+        {
+            sparse = categorical(ifeature);
+        }
+
+        m_generator_mapping(index, 0) = offset_columns - old_offset_columns;
+        m_generator_mapping(index, 1) = sparse ? 1 : 0;
+        ++index;
+    }
+
+    tensor_size_t sparse_columns = 0;
+    for (tensor_size_t column = 0; column < total_columns; ++column)
+    {
+        sparse_columns += m_generator_mapping(m_column_mapping(column, 0), 1);
+    }
+
+    m_dense_columns.resize(total_columns - sparse_columns);
+    m_sparse_columns.resize(sparse_columns);
+    for (tensor_size_t column = 0, idense = 0, isparse = 0; column < total_columns; ++column)
+    {
+        if (m_generator_mapping(m_column_mapping(column, 0), 1) != 0)
+        {
+            m_sparse_columns(isparse++) = column;
+        }
+        else
+        {
+            m_dense_columns(idense++) = column;
+        }
+    }
+}
+
+void dataset_t::uncache() const
+{
+    const std::scoped_lock lock(m_cache->m_mutex);
+    m_cache->m_quantized.clear();
+}
+
+const quantized_features_t& dataset_t::quantize(const tensor_size_t bins) const
+{
+    const std::scoped_lock lock(m_cache->m_mutex);
+
+    auto it = m_cache->m_quantized.find(bins);
+    if (it == m_cache->m_quantized.end())
+    {
+        const auto timer = ::nano::timer_t{};
+        it               = m_cache->m_quantized.emplace(bins, quantized_features_t{*this, bins}).first;
+        log(log_type::info, "dataset: quantized ", it->second.features().size(), " features using at most ", bins,
+            " bins in <", timer.elapsed(), ">.\n");
     }
+    return it->second;
 }
 
 tensor_size_t dataset_t::features() const
@@ -325,11 +385,28 @@ scalar_cmap_t dataset_t::select(indices_cmap_t samples, tensor_size_t feature, s
     check(samples);
     handle_scalar(feature, this->feature(feature));
 
+    const auto& generator = byfeature(feature);
+    const auto  ifeature  = m_feature_mapping(feature, 1);
+
+    // NB: map the original feature values directly if possible to avoid copying!
+    if (const auto view = generator->view(samples, ifeature); std::holds_alternative<scalar_cmap_t>(view))
+    {
+        return std::get<scalar_cmap_t>(view);
+    }
+
     auto storage = resize_and_map(buffer, samples.size());
-    byfeature(feature)->select(samples, m_feature_mapping(feature, 1), storage);
+    generator->select(samples, ifeature, storage);
     return storage;
 }
 
+scalar_view_t dataset_t::view(indices_cmap_t samples, tensor_size_t feature) const
+{
+    check(samples);
+    handle_scalar(feature, this->feature(feature));
+
+    return byfeature(feature)->view(samples, m_feature_mapping(feature, 1));
+}
+
 struct_cmap_t dataset_t::select(indices_cmap_t samples, tensor_size_t feature, struct_mem_t& buffer) const
 {
     check(samples);
@@ -358,6 +435,118 @@ tensor2d_map_t dataset_t::flatten(indices_cmap_t samples, tensor2d_t& buffer) co
     return storage;
 }
 
+void dataset_t::flatten(indices_cmap_t samples, sparse_flatten_t& buffer) const
+{
+    check(samples);
+
+    buffer.m_dense_columns  = m_dense_columns.tensor();
+    buffer.m_sparse_columns = m_sparse_columns.tensor();
+    buffer.m_defaults.resize(m_sparse_columns.size());
+    buffer.m_defaults.full(-1.0);
+    buffer.m_dense.resize(samples.size(), m_dense_columns.size());
+    buffer.m_offsets.resize(samples.size() + 1);
+    buffer.m_offsets.zero();
+
+    // NB: the sparse entries are collected feature by feature and then sorted by sample (counting sort).
+    struct entry_t
+    {
+        tensor_size_t m_sample{0}; ///<
+        tensor_size_t m_column{0}; ///<
+        scalar_t      m_value{0};  ///<
+    };
+
+    auto entries = std::vector<entry_t>{};
+    auto sclass  = sclass_mem_t{};
+    auto mclass  = mclass_mem_t{};
+
+    const auto append = [&](const tensor_size_t sample, const tensor_size_t column, const scalar_t value)
+    {
+        entries.push_back({sample, column, value});
+        ++buffer.m_offsets(sample + 1);
+    };
+
+    tensor_size_t index    = 0;
+    tensor_size_t ifeature = 0;
+    tensor_size_t idense   = 0;
+    tensor_size_t isparse  = 0;
+    for (const auto& generator : m_generators)
+    {
+        const auto colsize = m_generator_mapping(index, 0);
+        if (m_generator_mapping(index, 1) == 0)
+        {
+            generator->flatten(samples, buffer.m_dense.tensor(), idense);
+            idense += colsize;
+            ifeature += generator->features();
+        }
+        else
+        {
+            for (tensor_size_t i = 0; i < generator->features(); ++i, ++ifeature)
+            {
+                const auto feature = generator->feature(i);
+                if (feature.type() == feature_type::sclass)
+                {
+                    const auto classes = feature.classes() - 1;
+                    const auto values  = select(samples, ifeature, sclass);
+                    for (tensor_size_t sample = 0; sample < samples.size(); ++sample)
+                    {
+                        if (const auto label = values(sample); label < 0)
+                        {
+                            for (tensor_size_t column = 0; column < classes; ++column)
+                            {
+                                append(sample, isparse + column, generator_t::NaN);
+                            }
+                        }
+                        else if (label < classes)
+                        {
+                            append(sample, isparse + label, +1.0);
+                        }
+                    }
+                    isparse += classes;
+                }
+                else
+                {
+                    const auto classes = feature.classes();
+                    const auto values  = select(samples, ifeature, mclass);
+                    for (tensor_size_t sample = 0; sample < samples.size(); ++sample)
+                    {
+                        const auto missing = values(sample, 0) < 0;
+                        for (tensor_size_t column = 0; column < classes; ++column)
+                        {
+                            if (missing)
+                            {
+                                append(sample, isparse + column, generator_t::NaN);
+                            }
+                            else if (values(sample, column) != 0)
+                            {
+                                append(sample, isparse + column, +1.0);
+                            }
+                        }
+                    }
+                    isparse += classes;
+                }
+            }
+        }
+        ++index;
+    }
+
+    for (tensor_size_t sample = 0; sample < samples.size(); ++sample)
+    {
+        buffer.m_offsets(sample + 1) += buffer.m_offsets(sample);
+    }
+
+    const auto size = static_cast<tensor_size_t>(entries.size());
+    buffer.m_columns.resize(size);
+    buffer.m_values.resize(size);
+
+    auto positions = indices_t{buffer.m_offsets.slice(0, samples.size())};
+    for (const auto& entry : entries)
+    {
+        const auto k        = positions(entry.m_sample)++;
+        buffer.m_columns(k) = entry.m_column;
+        buffer.m_values(k)  = entry.m_value;
+    }
+}
+
 tensor3d_dims_t dataset_t::target_dims() const
 {
     switch (m_datasource.type())
@@ -450,6 +639,7 @@ tensor4d_map_t dataset_t::targets(indices_cmap_t samples, tensor4d_t& buffer) co
 
 void dataset_t::undrop() const
 {
+    uncache();
     for (const auto& generator : m_generators)
     {
         generator->undrop();
@@ -459,10 +649,12 @@ void dataset_t::undrop() const
 void dataset_t::drop(const tensor_size_t feature) const
 {
     byfeature(feature)->drop(m_feature_mapping(feature, 1));
+    uncache();
 }
 
 void dataset_t::unshuffle() const
 {
+    uncache();
     for (const auto& generator : m_generators)
     {
         generator->unshuffle();
@@ -472,6 +664,7 @@ void dataset_t::unshuffle() const
 void dataset_t::shuffle(const tensor_size_t feature) const
 {
     byfeature(feature)->shuffle(m_feature_mapping(feature, 1));
+    uncache();
 }
 
 indices_t dataset_t::shuffled(const tensor_size_t feature, indices_cmap_t samples) const
@@ -1,4 +1,9 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
 #include <nano/core/numeric.h>
+#include <nano/critical.h>
 #include <nano/dataset/iterator.h>
 
 using namespace nano;
@@ -9,6 +14,42 @@ auto features_per_thread(const indices_cmap_t& features, const size_t concurrenc
 {
     return std::max(tensor_size_t{1}, idiv(features.size(), concurrency));
 }
+
+constexpr auto min_samples_per_thread = tensor_size_t{1024};
+
+auto samples_per_thread(const indices_cmap_t& samples, const size_t concurrency)
+{
+    return std::max(min_samples_per_thread, idiv(samples.size(), concurrency));
+}
+
+template <class tbuffer, class tcallback>
+void loop_feature(const dataset_t& dataset, const indices_cmap_t& samples, const tensor_size_t ifeature,
+                  const tcallback& callback)
+{
+    if (samples.size() == 0)
+    {
+        return;
+    }
+    else if (samples.size() <= min_samples_per_thread)
+    {
+        auto buffer = tbuffer{};
+        callback(make_range(0, samples.size()), size_t{0U}, dataset.select(samples, ifeature, buffer));
+    }
+    else
+    {
+        const auto concurrency = dataset.concurrency();
+        const auto chunksize   = samples_per_thread(samples, concurrency);
+
+        auto buffers = std::vector<tbuffer>(concurrency);
+        dataset.thread_pool().map(samples.size(), chunksize,
+                                  [&](const tensor_size_t begin, const tensor_size_t end, const size_t tnum)
+                                  {
+                                      assert(tnum < buffers.size());
+                                      callback(make_range(begin, end), tnum,
+                                               dataset.select(samples.slice(begin, end), ifeature, buffers[tnum]));
+                                  });
+    }
+}
 } // namespace
 
 base_dataset_iterator_t::base_dataset_iterator_t(const dataset_t& dataset)
@@ -86,56 +127,345 @@ void targets_iterator_t::scaling(scaling_type scaling)
     m_scaling = scaling;
 }
 
+///
+/// \brief flatten feature values of the trailing samples stored in a scratch file.
+///
+/// NB: each thread reads its batches using its own file stream and
+///     prefetches asynchronously the next contiguous batch while the current one is processed.
+///
+class flatten_iterator_t::spill_t
+{
+public:
+    spill_t(string_t path, const tensor_size_t begin, const tensor_size_t end, const tensor_size_t row_bytes,
+            const size_t threads)
+        : m_path(std::move(path))
+        , m_begin(begin)
+        , m_end(end)
+        , m_row_bytes(row_bytes)
+        , m_writer(m_path, std::ios::binary | std::ios::trunc)
+        , m_readers(threads)
+    {
+        critical(m_writer.is_open(), "flatten iterator: cannot create the scratch file <", m_path, ">!");
+    }
+
+    spill_t(const spill_t&)            = delete;
+    spill_t(spill_t&&)                 = delete;
+    spill_t& operator=(const spill_t&) = delete;
+    spill_t& operator=(spill_t&&)      = delete;
+
+    ~spill_t()
+    {
+        for (auto& reader : m_readers)
+        {
+            if (reader.m_prefetch.valid())
+            {
+                reader.m_prefetch.wait();
+            }
+        }
+        m_readers.clear();
+        m_writer.close();
+
+        auto error = std::error_code{};
+        std::filesystem::remove(m_path, error);
+    }
+
+    void write(const tensor_size_t begin, const tensor_size_t end, const void* data)
+    {
+        assert(m_begin <= begin && begin <= end && end <= m_end);
+
+        const auto lock = std::scoped_lock{m_mutex};
+
+        m_writer.seekp(static_cast<std::streamoff>((begin - m_begin) * m_row_bytes));
+        m_writer.write(static_cast<const char*>(data), static_cast<std::streamsize>((end - begin) * m_row_bytes));
+        critical(m_writer.good(), "flatten iterator: cannot write to the scratch file <", m_path, ">!");
+    }
+
+    void flush()
+    {
+        m_writer.close();
+        critical(!m_writer.fail(), "flatten iterator: cannot write to the scratch file <", m_path, ">!");
+    }
+
+    void read(const size_t tnum, const tensor_size_t begin, const tensor_size_t end, void* data)
+    {
+        assert(tnum < m_readers.size());
+        assert(m_begin <= begin && begin <= end && end <= m_end);
+
+        auto& reader = m_readers[tnum];
+
+        // use the prefetched batch if matching, otherwise read it now
+        const auto bytes = static_cast<size_t>((end - begin) * m_row_bytes);
+        if (reader.m_prefetch.valid())
+        {
+            reader.m_prefetch.get();
+        }
+        if (reader.m_range.begin() == begin && reader.m_range.end() == end)
+        {
+            std::memcpy(data, reader.m_buffer.data(), bytes);
+        }
+        else
+        {
+            read(reader, begin, end, data);
+        }
+
+        // prefetch the next batch of the same size in the background
+        const auto next = make_range(end, std::min(end + (end - begin), m_end));
+        if (next.size() > 0)
+        {
+            reader.m_range = next;
+            reader.m_buffer.resize(static_cast<size_t>(next.size() * m_row_bytes));
+            reader.m_prefetch = std::async(std::launch::async, [this, &reader, next]()
+                                           { read(reader, next.begin(), next.end(), reader.m_buffer.data()); });
+        }
+        else
+        {
+            reader.m_range = tensor_range_t{};
+        }
+    }
+
+private:
+    struct reader_t
+    {
+        std::ifstream     m_stream;   ///< file stream dedicated to the thread
+        std::vector<char> m_buffer;   ///< prefetched feature values
+        tensor_range_t    m_range;    ///< range of the prefetched samples
+        std::future<void> m_prefetch; ///< pending prefetching (if any)
+    };
+
+    void read(reader_t& reader, const tensor_size_t begin, const tensor_size_t end, void* data) const
+    {
+        if (!reader.m_stream.is_open())
+        {
+            reader.m_stream.open(m_path, std::ios::binary);
+        }
+
+        reader.m_stream.seekg(static_cast<std::streamoff>((begin - m_begin) * m_row_bytes));
+        reader.m_stream.read(static_cast<char*>(data), static_cast<std::streamsize>((end - begin) * m_row_bytes));
+        critical(reader.m_stream.good(), "flatten iterator: cannot read from the scratch file <", m_path, ">!");
+    }
+
+    // attributes
+    string_t              m_path;         ///< path to the scratch file
+    tensor_size_t         m_begin{0};     ///< first spilled sample
+    tensor_size_t         m_end{0};       ///< last spilled sample (excluded)
+    tensor_size_t         m_row_bytes{0}; ///< number of bytes per sample
+    std::mutex            m_mutex;        ///< synchronization when writing
+    std::ofstream         m_writer;       ///<
+    std::vector<reader_t> m_readers;      ///< per-thread reader
+};
+
+flatten_cache_t::flatten_cache_t(const dataset_t& dataset, indices_cmap_t samples, const precision_type precision,
+                                 const tensor_size_t batch)
+    : m_dataset(dataset)
+    , m_precision(precision)
+    , m_rows(make_full_tensor<tensor_size_t>(make_dims(dataset.samples()), -1))
+{
+    const auto isize   = dataset.columns();
+    const auto float32 = precision == precision_type::float32;
+
+    for (tensor_size_t row = 0; row < samples.size(); ++row)
+    {
+        m_rows(samples(row)) = row;
+    }
+
+    m_flatten.resize(float32 ? 0 : samples.size(), isize);
+    m_flatten32.resize(float32 ? samples.size() : 0, isize);
+
+    auto buffers = std::vector<tensor2d_t>(dataset.concurrency());
+    dataset.thread_pool().map(samples.size(), std::max(batch, tensor_size_t{1}),
+                              [&](tensor_size_t begin, tensor_size_t end, size_t tnum)
+                              {
+                                  const auto range = make_range(begin, end);
+                                  const auto data  = dataset.flatten(samples.slice(range), buffers[tnum]);
+                                  if (float32)
+                                  {
+                                      m_flatten32.slice(range).matrix() = data.matrix().cast<float>();
+                                  }
+                                  else
+                                  {
+                                      m_flatten.slice(range) = data;
+                                  }
+                              });
+}
+
+bool flatten_cache_t::cached(indices_cmap_t samples) const
+{
+    return std::all_of(samples.begin(), samples.end(), [&](const tensor_size_t sample)
+                       { return sample >= 0 && sample < m_rows.size() && m_rows(sample) >= 0; });
+}
+
+void flatten_cache_t::gather(indices_cmap_t samples, tensor2d_map_t flatten) const
+{
+    assert(flatten.size<0>() == samples.size());
+    assert(flatten.size<1>() == m_dataset.columns());
+
+    for (tensor_size_t i = 0; i < samples.size(); ++i)
+    {
+        const auto row = m_rows(samples(i));
+        assert(row >= 0);
+
+        if (m_precision == precision_type::float32)
+        {
+            flatten.vector(i) = m_flatten32.vector(row).cast<scalar_t>();
+        }
+        else
+        {
+            flatten.vector(i) = m_flatten.vector(row);
+        }
+    }
+}
+
 flatten_iterator_t::flatten_iterator_t(const dataset_t& dataset, indices_cmap_t samples)
     : targets_iterator_t(dataset, samples)
     , m_flatten_stats(scalar_stats_t::make_flatten_stats(dataset, samples))
     , m_flatten_buffers(concurrency())
+    , m_flatten32_buffers(concurrency())
+    , m_sparse_buffers(concurrency())
 {
 }
 
+void flatten_iterator_t::discard()
+{
+    m_flatten.resize(0, 0);
+    m_flatten32.resize(0, 0);
+    m_spill.reset();
+    m_shared.reset();
+}
+
+void flatten_iterator_t::precision(const precision_type precision)
+{
+    m_precision = precision;
+    discard();
+}
+
 tensor2d_cmap_t flatten_iterator_t::flatten(tensor2d_map_t data) const
 {
     m_flatten_stats.scale(scaling(), data);
     return data;
 }
 
+tensor2d_cmap_t flatten_iterator_t::generate(size_t tnum, const tensor_range_t& range) const
+{
+    assert(tnum < m_flatten_buffers.size());
+    return flatten(dataset().flatten(samples().slice(range), m_flatten_buffers[tnum]));
+}
+
+template <class tscalar>
+tensor_cmap_t<tscalar, 2> flatten_iterator_t::spilled(const tensor_mem_t<tscalar, 2>& cached,
+                                                      tensor_mem_t<tscalar, 2>& buffer, const size_t tnum,
+                                                      const tensor_range_t& range) const
+{
+    const auto rows = cached.template size<0>();
+    if (range.end() <= rows)
+    {
+        return cached.slice(range);
+    }
+
+    // NB: the batch may start in memory and continue in the scratch file
+    const auto split = std::max(range.begin(), rows);
+
+    buffer.resize(range.size(), dataset().columns());
+    if (range.begin() < split)
+    {
+        buffer.slice(0, split - range.begin()) = cached.slice(range.begin(), split);
+    }
+    m_spill->read(tnum, split, range.end(), buffer.tensor(split - range.begin()).data());
+    return buffer.tensor();
+}
+
 tensor2d_cmap_t flatten_iterator_t::flatten(size_t tnum, const tensor_range_t& range) const
 {
+    assert(tnum < m_flatten_buffers.size());
+
     const auto& samples = this->samples();
-    const auto& dataset = this->dataset();
 
     if (m_flatten.size<0>() == samples.size())
     {
         return m_flatten.slice(range);
     }
+    else if (m_precision == precision_type::float32 && (m_flatten32.size<0>() == samples.size() || m_spill))
+    {
+        const auto data   = flatten32(tnum, range);
+        auto&      buffer = m_flatten_buffers[tnum];
+        buffer.resize(data.dims());
+        buffer.matrix() = data.matrix().cast<scalar_t>();
+        return buffer.tensor();
+    }
+    else if (m_spill)
+    {
+        return spilled(m_flatten, m_flatten_buffers[tnum], tnum, range);
+    }
+    else if (m_shared)
+    {
+        auto& buffer = m_flatten_buffers[tnum];
+        buffer.resize(range.size(), dataset().columns());
+        m_shared->gather(samples.slice(range), buffer.tensor());
+        return flatten(buffer.tensor());
+    }
     else
     {
-        assert(tnum < m_flatten_buffers.size());
-        return flatten(dataset.flatten(samples.slice(range), m_flatten_buffers[tnum]));
+        return generate(tnum, range);
+    }
+}
+
+flatten32_cmap_t flatten_iterator_t::flatten32(size_t tnum, const tensor_range_t& range) const
+{
+    assert(tnum < m_flatten32_buffers.size());
+
+    if (m_flatten32.size<0>() == samples().size())
+    {
+        return m_flatten32.slice(range);
+    }
+    else if (m_precision == precision_type::float32 && m_spill)
+    {
+        return spilled(m_flatten32, m_flatten32_buffers[tnum], tnum, range);
+    }
+    else
+    {
+        const auto data   = flatten(tnum, range);
+        auto&      buffer = m_flatten32_buffers[tnum];
+        buffer.resize(data.dims());
+        buffer.matrix() = data.matrix().cast<float>();
+        return buffer.tensor();
     }
 }
 
 bool flatten_iterator_t::cache_flatten(tensor_size_t max_bytes)
 {
     const auto& samples = this->samples();
-    const auto& dataset = this->dataset();
 
-    m_flatten.resize(0, 0);
+    discard();
+
+    const auto scalar_bytes =
+        static_cast<tensor_size_t>(m_precision == precision_type::float32 ? sizeof(float) : sizeof(scalar_t));
 
     auto cached = false;
-    if (const auto isize = dataset.columns();
-        static_cast<tensor_size_t>(sizeof(scalar_t)) * samples.size() * isize <= max_bytes)
+    if (const auto isize = dataset().columns(); scalar_bytes * samples.size() * isize <= max_bytes)
     {
         try
         {
-            m_flatten.resize(samples.size(), isize);
-            map(samples.size(), batch(),
-                [&](tensor_size_t begin, tensor_size_t end, size_t tnum)
-                {
-                    assert(tnum < m_flatten_buffers.size());
-                    const auto range       = make_range(begin, end);
-                    m_flatten.slice(range) = flatten(dataset.flatten(samples.slice(range), m_flatten_buffers[tnum]));
-                });
+            if (m_precision == precision_type::float32)
+            {
+                auto flatten32 = flatten32_t{samples.size(), isize};
+                map(samples.size(), batch(),
+                    [&](tensor_size_t begin, tensor_size_t end, size_t tnum)
+                    {
+                        const auto range                = make_range(begin, end);
+                        flatten32.slice(range).matrix() = generate(tnum, range).matrix().cast<float>();
+                    });
+                m_flatten32 = std::move(flatten32);
+            }
+            else
+            {
+                auto flatten64 = tensor2d_t{samples.size(), isize};
+                map(samples.size(), batch(),
+                    [&](tensor_size_t begin, tensor_size_t end, size_t tnum)
+                    {
+                        const auto range       = make_range(begin, end);
+                        flatten64.slice(range) = generate(tnum, range);
+                    });
+                m_flatten = std::move(flatten64);
+            }
             cached = true;
         }
         catch (...) // NOLINT(bugprone-empty-catch)
@@ -146,6 +476,225 @@ bool flatten_iterator_t::cache_flatten(tensor_size_t max_bytes)
     return cached;
 }
 
+tensor_size_t flatten_iterator_t::cache_flatten(const tensor_size_t max_bytes, const string_t& scratch_path)
+{
+    const auto& samples = this->samples();
+
+    discard();
+
+    const auto isize     = dataset().columns();
+    const auto float32   = m_precision == precision_type::float32;
+    const auto row_bytes = static_cast<tensor_size_t>(float32 ? sizeof(float) : sizeof(scalar_t)) * isize;
+    const auto rows      = std::clamp(max_bytes / std::max(row_bytes, tensor_size_t{1}), tensor_size_t{0},
+                                      samples.size());
+
+    auto flatten32 = flatten32_t{float32 ? rows : 0, isize};
+    auto flatten64 = tensor2d_t{float32 ? 0 : rows, isize};
+    auto spill     = (rows < samples.size())
+                       ? std::make_shared<spill_t>(scratch_path, rows, samples.size(), row_bytes, concurrency())
+                       : rspill_t{};
+
+    map(samples.size(), batch(),
+        [&](tensor_size_t begin, tensor_size_t end, size_t tnum)
+        {
+            const auto data  = generate(tnum, make_range(begin, end));
+            const auto split = std::clamp(rows, begin, end);
+
+            if (float32)
+            {
+                auto& buffer = m_flatten32_buffers[tnum];
+                buffer.resize(data.dims());
+                buffer.matrix() = data.matrix().cast<float>();
+
+                if (begin < split)
+                {
+                    flatten32.slice(begin, split) = buffer.slice(0, split - begin);
+                }
+                if (split < end)
+                {
+                    spill->write(split, end, buffer.tensor(split - begin).data());
+                }
+            }
+            else
+            {
+                if (begin < split)
+                {
+                    flatten64.slice(begin, split) = data.slice(0, split - begin);
+                }
+                if (split < end)
+                {
+                    spill->write(split, end, data.tensor(split - begin).data());
+                }
+            }
+        });
+
+    if (spill)
+    {
+        spill->flush();
+    }
+
+    m_flatten32 = std::move(flatten32);
+    m_flatten   = std::move(flatten64);
+    m_spill     = std::move(spill);
+
+    return rows;
+}
+
+bool flatten_iterator_t::cache_flatten(rflatten_cache_t cache)
+{
+    discard();
+
+    if (cache == nullptr || &cache->dataset() != &dataset() || !cache->cached(samples()))
+    {
+        return false;
+    }
+
+    m_shared = std::move(cache);
+    return true;
+}
+
+bool flatten_iterator_t::cache_sparse(const tensor_size_t max_bytes)
+{
+    const auto& samples = this->samples();
+
+    m_sparse = sparse_flatten_t{};
+
+    // generate the sparse entries by batch in parallel and then concatenate them
+    const auto batches = (samples.size() + batch() - 1) / batch();
+
+    auto buffers = std::vector<sparse_flatten_t>(static_cast<size_t>(batches));
+    map(batches,
+        [&](tensor_size_t index, size_t)
+        {
+            const auto begin = index * batch();
+            const auto end   = std::min(begin + batch(), samples.size());
+            dataset().flatten(samples.slice(begin, end), buffers[static_cast<size_t>(index)]);
+        });
+
+    tensor_size_t entries = 0;
+    for (const auto& buffer : buffers)
+    {
+        entries += buffer.m_columns.size();
+    }
+
+    const auto dense_size   = samples.size() * dataset().dense_columns().size();
+    const auto dense_bytes  = static_cast<tensor_size_t>(sizeof(scalar_t)) * dense_size;
+    const auto sparse_bytes = static_cast<tensor_size_t>(sizeof(tensor_size_t) + sizeof(scalar_t)) * entries;
+    if (dense_bytes + sparse_bytes > max_bytes)
+    {
+        return false;
+    }
+
+    auto cached = sparse_flatten_t{};
+    cached.m_dense_columns  = dataset().dense_columns();
+    cached.m_sparse_columns = dataset().sparse_columns();
+    cached.m_defaults       = make_full_tensor<scalar_t>(make_dims(cached.m_sparse_columns.size()), -1.0);
+    cached.m_dense.resize(samples.size(), cached.m_dense_columns.size());
+    cached.m_offsets.resize(samples.size() + 1);
+    cached.m_columns.resize(entries);
+    cached.m_values.resize(entries);
+
+    tensor_size_t row   = 0;
+    tensor_size_t entry = 0;
+    cached.m_offsets(0) = 0;
+    for (const auto& buffer : buffers)
+    {
+        const auto rows = buffer.samples();
+        const auto size = buffer.m_columns.size();
+
+        cached.m_dense.slice(row, row + rows)       = buffer.m_dense;
+        cached.m_columns.slice(entry, entry + size) = buffer.m_columns;
+        cached.m_values.slice(entry, entry + size)  = buffer.m_values;
+        for (tensor_size_t i = 0; i < rows; ++i)
+        {
+            cached.m_offsets(row + i + 1) = entry + buffer.m_offsets(i + 1);
+        }
+
+        row += rows;
+        entry += size;
+    }
+
+    m_sparse = std::move(cached);
+    return true;
+}
+
+tensor2d_t flatten_iterator_t::sparse_values() const
+{
+    // NB: the sparse columns take only the values: -1 (default), +1 (active) or NaN (missing),
+    //  so it is enough to scale once the first two values as the missing ones are replaced with zero.
+    const auto size = dataset().sparse_columns().size();
+
+    auto values = tensor2d_t{2, size};
+    values.tensor(0).full(-1.0);
+    values.tensor(1).full(+1.0);
+    m_flatten_stats.select(dataset().sparse_columns()).scale(scaling(), values.tensor());
+    return values;
+}
+
+const sparse_flatten_t& flatten_iterator_t::sparse(const size_t tnum, const tensor_range_t& range,
+                                                   const scalar_stats_t& dense_stats,
+                                                   const tensor2d_t& sparse_values) const
+{
+    assert(tnum < m_sparse_buffers.size());
+
+    auto& buffer = m_sparse_buffers[tnum];
+    if (m_sparse.samples() == samples().size())
+    {
+        const auto begin = m_sparse.m_offsets(range.begin());
+        const auto end   = m_sparse.m_offsets(range.end());
+
+        buffer.m_dense_columns  = dataset().dense_columns();
+        buffer.m_sparse_columns = dataset().sparse_columns();
+        buffer.m_dense          = m_sparse.m_dense.slice(range);
+        buffer.m_columns        = m_sparse.m_columns.slice(begin, end);
+        buffer.m_values         = m_sparse.m_values.slice(begin, end);
+        buffer.m_offsets          = m_sparse.m_offsets.slice(range.begin(), range.end() + 1);
+        buffer.m_offsets.array() -= begin;
+    }
+    else
+    {
+        dataset().flatten(samples().slice(range), buffer);
+    }
+
+    dense_stats.scale(scaling(), buffer.m_dense.tensor());
+
+    buffer.m_defaults = sparse_values.tensor(0);
+    for (tensor_size_t k = 0, size = buffer.m_values.size(); k < size; ++k)
+    {
+        buffer.m_values(k) = std::isfinite(buffer.m_values(k)) ? sparse_values(1, buffer.m_columns(k)) : 0.0;
+    }
+
+    return buffer;
+}
+
+void flatten_iterator_t::loop(const sparse_targets_callback_t& callback) const
+{
+    const auto dense_stats   = m_flatten_stats.select(dataset().dense_columns());
+    const auto sparse_values = this->sparse_values();
+
+    map(samples().size(), batch(),
+        [&](tensor_size_t begin, tensor_size_t end, size_t tnum)
+        {
+            const auto range = make_range(begin, end);
+
+            callback(range, tnum, sparse(tnum, range, dense_stats, sparse_values), targets(tnum, range));
+        });
+}
+
+void flatten_iterator_t::loop(const sparse_callback_t& callback) const
+{
+    const auto dense_stats   = m_flatten_stats.select(dataset().dense_columns());
+    const auto sparse_values = this->sparse_values();
+
+    map(samples().size(), batch(),
+        [&](tensor_size_t begin, tensor_size_t end, size_t tnum)
+        {
+            const auto range = make_range(begin, end);
+
+            callback(range, tnum, sparse(tnum, range, dense_stats, sparse_values));
+        });
+}
+
 void flatten_iterator_t::loop(const flatten_targets_callback_t& callback) const
 {
     map(samples().size(), batch(),
@@ -168,6 +717,28 @@ void flatten_iterator_t::loop(const flatten_callback_t& callback) const
         });
 }
 
+void flatten_iterator_t::loop(const flatten32_targets_callback_t& callback) const
+{
+    map(samples().size(), batch(),
+        [&](tensor_size_t begin, tensor_size_t end, size_t tnum)
+        {
+            const auto range = make_range(begin, end);
+
+            callback(range, tnum, flatten32(tnum, range), targets(tnum, range));
+        });
+}
+
+void flatten_iterator_t::loop(const flatten32_callback_t& callback) const
+{
+    map(samples().size(), batch(),
+        [&](tensor_size_t begin, tensor_size_t end, size_t tnum)
+        {
+            const auto range = make_range(begin, end);
+
+            callback(range, tnum, flatten32(tnum, range));
+        });
+}
+
 void targets_iterator_t::loop(const targets_callback_t& callback) const
 {
     map(samples().size(), batch(),
@@ -209,28 +780,28 @@ void select_iterator_t::loop(indices_cmap_t samples, const struct_callback_t& ca
     loop(samples, m_struct_features, callback);
 }
 
-void select_iterator_t::loop(indices_cmap_t samples, tensor_size_t ifeature, const sclass_callback_t& callback) const
+void select_iterator_t::loop(indices_cmap_t samples, tensor_size_t ifeature,
+                             const sclass_range_callback_t& callback) const
 {
-    const auto tnum = size_t{0U};
-    callback(ifeature, tnum, dataset().select(samples, ifeature, m_buffers[tnum].m_sclass));
+    loop_feature<sclass_mem_t>(dataset(), samples, ifeature, callback);
 }
 
-void select_iterator_t::loop(indices_cmap_t samples, tensor_size_t ifeature, const mclass_callback_t& callback) const
+void select_iterator_t::loop(indices_cmap_t samples, tensor_size_t ifeature,
+                             const mclass_range_callback_t& callback) const
 {
-    const auto tnum = size_t{0U};
-    callback(ifeature, tnum, dataset().select(samples, ifeature, m_buffers[tnum].m_mclass));
+    loop_feature<mclass_mem_t>(dataset(), samples, ifeature, callback);
 }
 
-void select_iterator_t::loop(indices_cmap_t samples, tensor_size_t ifeature, const scalar_callback_t& callback) const
+void select_iterator_t::loop(indices_cmap_t samples, tensor_size_t ifeature,
+                             const scalar_range_callback_t& callback) const
 {
-    const auto tnum = size_t{0U};
-    callback(ifeature, tnum, dataset().select(samples, ifeature, m_buffers[tnum].m_scalar));
+    loop_feature<scalar_mem_t>(dataset(), samples, ifeature, callback);
 }
 
-void select_iterator_t::loop(indices_cmap_t samples, tensor_size_t ifeature, const struct_callback_t& callback) const
+void select_iterator_t::loop(indices_cmap_t samples, tensor_size_t ifeature,
+                             const struct_range_callback_t& callback) const
 {
-    const auto tnum = size_t{0U};
-    callback(ifeature, tnum, dataset().select(samples, ifeature, m_buffers[tnum].m_struct));
+    loop_feature<struct_mem_t>(dataset(), samples, ifeature, callback);
 }
 
 void select_iterator_t::loop(indices_cmap_t samples, indices_cmap_t features, const sclass_callback_t& callback) const
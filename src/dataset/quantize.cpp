@@ -0,0 +1,115 @@
+#include <nano/dataset/iterator.h>
+#include <nano/dataset/quantize.h>
+
+using namespace nano;
+
+namespace
+{
+auto make_thresholds(std::vector<scalar_t>& values, const tensor_size_t bins)
+{
+    std::sort(values.begin(), values.end());
+
+    const auto size = static_cast<tensor_size_t>(values.size());
+    const auto at   = [&](const tensor_size_t i) { return values[static_cast<size_t>(i)]; };
+
+    tensor_size_t distinct = size > 0 ? 1 : 0;
+    for (tensor_size_t i = 1; i < size && distinct <= bins; ++i)
+    {
+        distinct += (at(i - 1) < at(i)) ? 1 : 0;
+    }
+
+    std::vector<scalar_t> thresholds;
+    if (distinct <= bins)
+    {
+        // NB: few distinct values, so each gets its own bin (equivalent to the exact split search)!
+        for (tensor_size_t i = 1; i < size; ++i)
+        {
+            if (at(i - 1) < at(i))
+            {
+                thresholds.push_back(0.5 * (at(i - 1) + at(i)));
+            }
+        }
+    }
+    else
+    {
+        // NB: many distinct values, so split at the quantiles (without splitting identical values)!
+        for (tensor_size_t bin = 1, last = 0; bin < bins; ++bin)
+        {
+            auto i = std::max(last + 1, bin * size / bins);
+            while (i < size && !(at(i - 1) < at(i)))
+            {
+                ++i;
+            }
+            if (i >= size)
+            {
+                break;
+            }
+
+            thresholds.push_back(0.5 * (at(i - 1) + at(i)));
+            last = i;
+        }
+    }
+
+    return thresholds;
+}
+} // namespace
+
+quantized_features_t::quantized_features_t(const dataset_t& dataset, const tensor_size_t bins)
+    : m_bins(std::clamp(bins, tensor_size_t{1}, max_bins))
+    , m_features(make_scalar_features(dataset))
+    , m_mapping(dataset.features())
+    , m_counts(m_features.size())
+    , m_thresholds(m_features.size(), m_bins - 1)
+    , m_codes(m_features.size(), dataset.samples())
+{
+    m_mapping.full(-1);
+    for (tensor_size_t i = 0; i < m_features.size(); ++i)
+    {
+        m_mapping(m_features(i)) = i;
+    }
+
+    m_thresholds.full(std::numeric_limits<scalar_t>::infinity());
+
+    const auto samples  = arange(0, dataset.samples());
+    const auto iterator = select_iterator_t{dataset};
+    iterator.loop(samples, m_features,
+                  [&](const tensor_size_t feature, size_t, const scalar_cmap_t& fvalues)
+                  {
+                      const auto ifeature = m_mapping(feature);
+
+                      // gather the given feature values
+                      auto values = std::vector<scalar_t>{};
+                      values.reserve(static_cast<size_t>(fvalues.size()));
+                      for (tensor_size_t i = 0; i < fvalues.size(); ++i)
+                      {
+                          if (const auto value = fvalues(i); std::isfinite(value))
+                          {
+                              values.push_back(value);
+                          }
+                      }
+
+                      // estimate the thresholds between bins
+                      const auto thresholds = make_thresholds(values, m_bins);
+
+                      const auto count = static_cast<tensor_size_t>(thresholds.size());
+                      for (tensor_size_t i = 0; i < count; ++i)
+                      {
+                          m_thresholds(ifeature, i) = thresholds[static_cast<size_t>(i)];
+                      }
+                      m_counts(ifeature) = count + 1;
+
+                      // map feature values to bins
+                      for (tensor_size_t i = 0; i < fvalues.size(); ++i)
+                      {
+                          if (const auto value = fvalues(i); std::isfinite(value))
+                          {
+                              const auto it = std::upper_bound(thresholds.begin(), thresholds.end(), value);
+                              m_codes(ifeature, i) = static_cast<uint8_t>(std::distance(thresholds.begin(), it));
+                          }
+                          else
+                          {
+                              m_codes(ifeature, i) = missing_bin;
+                          }
+                      }
+                  });
+}
@@ -0,0 +1,33 @@
+#include <nano/dataset/sparse.h>
+
+using namespace nano;
+
+void sparse_flatten_t::densify(const tensor_size_t sample, tensor1d_map_t values) const
+{
+    assert(sample >= 0 && sample < samples());
+    assert(values.size() == columns());
+
+    for (tensor_size_t i = 0, size = m_dense_columns.size(); i < size; ++i)
+    {
+        values(m_dense_columns(i)) = m_dense(sample, i);
+    }
+    for (tensor_size_t j = 0, size = m_sparse_columns.size(); j < size; ++j)
+    {
+        values(m_sparse_columns(j)) = m_defaults(j);
+    }
+    for (auto k = m_offsets(sample); k < m_offsets(sample + 1); ++k)
+    {
+        values(m_sparse_columns(m_columns(k))) = m_values(k);
+    }
+}
+
+void sparse_flatten_t::densify(tensor2d_map_t values) const
+{
+    assert(values.size<0>() == samples());
+    assert(values.size<1>() == columns());
+
+    for (tensor_size_t sample = 0, size = samples(); sample < size; ++sample)
+    {
+        densify(sample, values.tensor(sample));
+    }
+}
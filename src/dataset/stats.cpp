@@ -354,6 +354,26 @@ scalar_stats_t scalar_stats_t::make_feature_stats(const dataset_t& dataset, indi
     return stats;
 }
 
+scalar_stats_t scalar_stats_t::select(indices_cmap_t components) const
+{
+    auto stats = scalar_stats_t{components.size()};
+    for (tensor_size_t i = 0; i < components.size(); ++i)
+    {
+        const auto component = components(i);
+
+        stats.m_samples(i)   = m_samples(component);
+        stats.m_min(i)       = m_min(component);
+        stats.m_max(i)       = m_max(component);
+        stats.m_mean(i)      = m_mean(component);
+        stats.m_stdev(i)     = m_stdev(component);
+        stats.m_div_range(i) = m_div_range(component);
+        stats.m_mul_range(i) = m_mul_range(component);
+        stats.m_div_stdev(i) = m_div_stdev(component);
+        stats.m_mul_stdev(i) = m_mul_stdev(component);
+    }
+    return stats;
+}
+
 void scalar_stats_t::scale(const scaling_type scaling, tensor2d_map_t values) const
 {
     assert(values.size<1>() == m_min.size());
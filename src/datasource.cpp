@@ -1,11 +1,121 @@
+#include <cstring>
+#include <fstream>
 #include <mutex>
 #include <nano/core/chrono.h>
 #include <nano/datasource/imclass_cifar.h>
 #include <nano/datasource/imclass_mnist.h>
 #include <nano/datasource/tabular.h>
+#include <nano/tensor/stream.h>
+#include <sstream>
+
+#ifdef _WIN32
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
 
 using namespace nano;
 
+namespace
+{
+// binary columnar format:
+//  - prefix: magic number, version and the size of the header,
+//  - header: features, target index, number of samples and testing flags,
+//  - (aligned) per-type storage of the feature values and the storage of the feature value masks.
+constexpr auto binary_magic       = uint64_t{0x314E49424F4E414EULL}; // "NANOBIN1"
+constexpr auto binary_version     = uint64_t{1U};
+constexpr auto binary_prefix_size = uint64_t{3U * sizeof(uint64_t)};
+constexpr auto binary_page_size   = uint64_t{4096U};
+constexpr auto binary_alignment   = uint64_t{64U};
+
+auto align_offset(const uint64_t offset, const uint64_t alignment)
+{
+    return (offset + alignment - 1U) / alignment * alignment;
+}
+} // namespace
+
+///
+/// \brief read-only memory-mapped file.
+///
+struct datasource_t::mapping_t
+{
+    explicit mapping_t(const string_t& path)
+    {
+#ifdef _WIN32
+        m_file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                               FILE_ATTRIBUTE_NORMAL, nullptr);
+        critical(m_file != INVALID_HANDLE_VALUE, "datasource: cannot open file <", path, ">!");
+
+        LARGE_INTEGER size;
+        critical(::GetFileSizeEx(m_file, &size) != 0 && size.QuadPart > 0, "datasource: invalid file <", path, ">!");
+        m_size = static_cast<size_t>(size.QuadPart);
+
+        m_mapping = ::CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        critical(m_mapping != nullptr, "datasource: cannot map file <", path, ">!");
+
+        m_data = static_cast<const uint8_t*>(::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        critical(m_data != nullptr, "datasource: cannot map file <", path, ">!");
+#else
+        const auto fd = ::open(path.c_str(), O_RDONLY); // NOLINT(cppcoreguidelines-pro-type-vararg)
+        critical(fd >= 0, "datasource: cannot open file <", path, ">!");
+
+        struct stat info = {};
+        if (::fstat(fd, &info) != 0 || info.st_size <= 0)
+        {
+            ::close(fd);
+            raise("datasource: invalid file <", path, ">!");
+        }
+        m_size = static_cast<size_t>(info.st_size);
+
+        auto* data = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        critical(data != MAP_FAILED, "datasource: cannot map file <", path, ">!");
+
+        m_data = static_cast<const uint8_t*>(data);
+#endif
+    }
+
+    mapping_t(const mapping_t&)            = delete;
+    mapping_t(mapping_t&&)                 = delete;
+    mapping_t& operator=(const mapping_t&) = delete;
+    mapping_t& operator=(mapping_t&&)      = delete;
+
+    ~mapping_t()
+    {
+#ifdef _WIN32
+        if (m_data != nullptr)
+        {
+            ::UnmapViewOfFile(m_data);
+        }
+        if (m_mapping != nullptr)
+        {
+            ::CloseHandle(m_mapping);
+        }
+        if (m_file != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(m_file);
+        }
+#else
+        if (m_data != nullptr)
+        {
+            ::munmap(const_cast<uint8_t*>(m_data), m_size); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+        }
+#endif
+    }
+
+    // attributes
+#ifdef _WIN32
+    HANDLE m_file{INVALID_HANDLE_VALUE}; ///<
+    HANDLE m_mapping{nullptr};           ///<
+#endif
+    const uint8_t* m_data{nullptr}; ///< start of the mapped file
+    size_t         m_size{0U};      ///< size of the mapped file in bytes
+};
+
 datasource_t::datasource_t(string_t id)
     : typed_t(std::move(id))
 {
@@ -52,9 +162,10 @@ void datasource_t::resize(const tensor_size_t samples, const features_t& feature
     this->resize(samples, features, string_t::npos);
 }
 
-void datasource_t::resize(const tensor_size_t samples, const features_t& features, const size_t target)
+datasource_t::storage_sizes_t datasource_t::layout(const tensor_size_t samples, const features_t& features,
+                                                  const size_t target)
 {
-    auto       size_storage        = std::unordered_map<feature_type, tensor_size_t>{};
+    auto       size_storage        = storage_sizes_t{};
     const auto update_size_storage = [&](feature_type type, auto size)
     {
         const auto begin   = size_storage[type];
@@ -106,6 +217,13 @@ void datasource_t::resize(const tensor_size_t samples, const features_t& feature
     m_features = features;
     m_target   = (target < features.size()) ? static_cast<tensor_size_t>(target) : m_storage_range.size();
 
+    return size_storage;
+}
+
+void datasource_t::resize(const tensor_size_t samples, const features_t& features, const size_t target)
+{
+    auto size_storage = layout(samples, features, target);
+
     m_storage_f32.resize(size_storage[feature_type::float32], samples);
     m_storage_f64.resize(size_storage[feature_type::float64], samples);
     m_storage_i08.resize(size_storage[feature_type::int8], samples);
@@ -116,20 +234,129 @@ void datasource_t::resize(const tensor_size_t samples, const features_t& feature
     m_storage_u16.resize(size_storage[feature_type::uint16], samples);
     m_storage_u32.resize(size_storage[feature_type::uint32], samples);
     m_storage_u64.resize(size_storage[feature_type::uint64], samples);
+    m_storage_mask.resize(static_cast<tensor_size_t>(features.size()), (samples + 7) / 8);
 
-    m_storage_f32.zero();
-    m_storage_f64.zero();
-    m_storage_i08.zero();
-    m_storage_i16.zero();
-    m_storage_i32.zero();
-    m_storage_i64.zero();
-    m_storage_u08.zero();
-    m_storage_u16.zero();
-    m_storage_u32.zero();
-    m_storage_u64.zero();
+    m_mapping.reset();
+}
 
-    m_storage_mask.resize(static_cast<tensor_size_t>(features.size()), (samples + 7) / 8);
-    m_storage_mask.zero();
+void datasource_t::save(const string_t& path) const
+{
+    auto header = std::ostringstream{};
+    critical(::nano::write(header, m_features) &&
+                 ::nano::write(header, static_cast<uint64_t>(has_target() ? m_target : -1)) &&
+                 ::nano::write(header, static_cast<int64_t>(samples())) && ::nano::write(header, m_testing),
+             "datasource[", type_id(), "]: failed to serialize the header!");
+
+    const auto header_str  = header.str();
+    const auto header_size = static_cast<uint64_t>(header_str.size());
+
+    auto stream = std::ofstream{path, std::ios::binary | std::ios::trunc};
+    critical(stream.is_open(), "datasource[", type_id(), "]: cannot open file <", path, ">!");
+
+    auto       offset = uint64_t{0U};
+    const auto pad    = [&](const uint64_t alignment)
+    {
+        const auto padding = align_offset(offset, alignment) - offset;
+        for (uint64_t i = 0U; i < padding; ++i)
+        {
+            stream.put('\0');
+        }
+        offset += padding;
+    };
+    const auto write_storage = [&]<class tscalar>(const storage_t<tscalar>& storage)
+    {
+        const auto data = storage.tensor();
+
+        pad(binary_alignment);
+        ::nano::write(stream, data.data(), data.size());
+        offset += static_cast<uint64_t>(data.size()) * sizeof(tscalar);
+    };
+
+    ::nano::write(stream, binary_magic);
+    ::nano::write(stream, binary_version);
+    ::nano::write(stream, header_size);
+    ::nano::write(stream, header_str.data(), header_str.size());
+    offset = binary_prefix_size + header_size;
+
+    pad(binary_page_size);
+    write_storage(m_storage_f32);
+    write_storage(m_storage_f64);
+    write_storage(m_storage_i08);
+    write_storage(m_storage_i16);
+    write_storage(m_storage_i32);
+    write_storage(m_storage_i64);
+    write_storage(m_storage_u08);
+    write_storage(m_storage_u16);
+    write_storage(m_storage_u32);
+    write_storage(m_storage_u64);
+    write_storage(m_storage_mask);
+
+    critical(stream.good(), "datasource[", type_id(), "]: failed to write file <", path, ">!");
+}
+
+void datasource_t::map(const string_t& path)
+{
+    auto mapping = std::make_shared<const mapping_t>(path);
+
+    const auto* const data = mapping->m_data;
+    const auto        size = static_cast<uint64_t>(mapping->m_size);
+
+    // read the prefix and the header
+    auto magic = uint64_t{0U}, version = uint64_t{0U}, header_size = uint64_t{0U};
+    critical(size >= binary_prefix_size, "datasource[", type_id(), "]: invalid binary file <", path, ">!");
+
+    std::memcpy(&magic, data, sizeof(uint64_t));
+    std::memcpy(&version, data + sizeof(uint64_t), sizeof(uint64_t));
+    std::memcpy(&header_size, data + 2U * sizeof(uint64_t), sizeof(uint64_t));
+
+    critical(magic == binary_magic && version == binary_version && binary_prefix_size + header_size <= size,
+             "datasource[", type_id(), "]: invalid binary file <", path, ">!");
+
+    auto features = features_t{};
+    auto target   = uint64_t{0U};
+    auto samples  = int64_t{0};
+    auto testing  = indices_t{};
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto header = std::istringstream{string_t{reinterpret_cast<const char*>(data + binary_prefix_size),
+                                                  static_cast<size_t>(header_size)}};
+        critical(::nano::read(header, features) && ::nano::read(header, target) &&
+                     ::nano::read(header, samples) && ::nano::read(header, testing) && samples >= 0 &&
+                     testing.size() == samples,
+                 "datasource[", type_id(), "]: invalid header in binary file <", path, ">!");
+    }
+
+    // map the feature values and masks without copying
+    auto size_storage = layout(samples, features, static_cast<size_t>(target));
+    m_testing         = testing;
+
+    auto       offset      = align_offset(binary_prefix_size + header_size, binary_page_size);
+    const auto map_storage = [&]<class tscalar>(storage_t<tscalar>& storage, const tensor_size_t rows,
+                                                const tensor_size_t cols)
+    {
+        offset = align_offset(offset, binary_alignment);
+
+        const auto bytes = static_cast<uint64_t>(rows * cols) * sizeof(tscalar);
+        critical(offset + bytes <= size, "datasource[", type_id(), "]: truncated binary file <", path, ">!");
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        storage.map(reinterpret_cast<const tscalar*>(data + offset), rows, cols);
+        offset += bytes;
+    };
+
+    map_storage(m_storage_f32, size_storage[feature_type::float32], samples);
+    map_storage(m_storage_f64, size_storage[feature_type::float64], samples);
+    map_storage(m_storage_i08, size_storage[feature_type::int8], samples);
+    map_storage(m_storage_i16, size_storage[feature_type::int16], samples);
+    map_storage(m_storage_i32, size_storage[feature_type::int32], samples);
+    map_storage(m_storage_i64, size_storage[feature_type::int64], samples);
+    map_storage(m_storage_u08, size_storage[feature_type::uint8], samples);
+    map_storage(m_storage_u16, size_storage[feature_type::uint16], samples);
+    map_storage(m_storage_u32, size_storage[feature_type::uint32], samples);
+    map_storage(m_storage_u64, size_storage[feature_type::uint64], samples);
+    map_storage(m_storage_mask, static_cast<tensor_size_t>(features.size()), (samples + 7) / 8);
+
+    m_mapping = std::move(mapping);
 }
 
 task_type datasource_t::type() const
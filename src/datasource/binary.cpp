@@ -0,0 +1,23 @@
+#include <nano/datasource/binary.h>
+
+using namespace nano;
+
+binary_datasource_t::binary_datasource_t(string_t id, string_t path)
+    : datasource_t(std::move(id))
+    , m_path(std::move(path))
+{
+}
+
+rdatasource_t binary_datasource_t::clone() const
+{
+    return std::make_unique<binary_datasource_t>(*this);
+}
+
+void binary_datasource_t::do_load()
+{
+    const auto basedir = parameter("datasource::basedir").value<string_t>();
+    const auto path    = basedir.empty() ? m_path : basedir + "/" + m_path;
+
+    log_info("[", type_id(), "]: mapping file <", path, ">...");
+    map(path);
+}
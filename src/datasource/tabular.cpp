@@ -1,9 +1,34 @@
+#include <nano/core/parallel.h>
 #include <nano/core/tokenizer.h>
 #include <nano/critical.h>
 #include <nano/datasource/tabular.h>
+#include <numeric>
+#include <unordered_set>
 
 using namespace nano;
 
+namespace
+{
+///
+/// \brief minimum number of bytes of a chunk of lines to process in parallel.
+///
+constexpr auto min_chunk_size = std::streamoff{1} << 20;
+
+///
+/// \brief chunk of lines of a CSV file to process in parallel.
+///
+struct part_t
+{
+    size_t                 m_csv{0U};    ///< index of the CSV file
+    csv_chunk_t            m_chunk;      ///< range of bytes in the CSV file
+    tensor_size_t          m_lines{0};   ///< number of lines (including the skipped ones)
+    tensor_size_t          m_samples{0}; ///< number of samples (aka lines not skipped)
+    tensor_size_t          m_line0{0};   ///< index of the first line relative to the CSV file
+    tensor_size_t          m_sample0{0}; ///< index of the first sample relative to the dataset
+    std::vector<strings_t> m_labels;     ///< new labels per categorical feature in the order of their appearance
+};
+} // namespace
+
 tabular_datasource_t::tabular_datasource_t(string_t id, csvs_t csvs, features_t features)
     : tabular_datasource_t(std::move(id), std::move(csvs), std::move(features), string_t::npos)
 {
@@ -42,46 +67,139 @@ void tabular_datasource_t::do_load()
              "]: the target feature index (", m_target, ") is not valid, expecting in the [0, ", m_features.size(),
              ") range!");
 
-    // allocate storage
-    tensor_size_t samples = 0;
-    for (const auto& csv : m_csvs)
+    // split the CSV files into chunks of lines to process in parallel
+    auto& pool = parallel::scheduler_t::shared();
+
+    auto parts = std::vector<part_t>{};
+    for (size_t icsv = 0U; icsv < m_csvs.size(); ++icsv)
     {
-        csv.parse(basedir,
-                  [&](const string_t&, const tensor_size_t)
-                  {
-                      ++samples;
-                      return true;
-                  });
+        for (const auto& chunk : m_csvs[icsv].split(basedir, 4U * pool.size(), min_chunk_size))
+        {
+            parts.push_back(part_t{icsv, chunk});
+        }
     }
 
-    critical(samples > 0, "datasource[", type_id(), "]: no data to read, check paths!");
+    // count the samples and collect the labels of the categorical features not known yet
+    const auto unknown = [](const string_t& label) { return label.empty(); };
 
-    resize(samples, m_features, m_target);
+    auto is_cate = std::vector<bool>(m_features.size(), false);
+    for (size_t f = 0U; f < m_features.size(); ++f)
+    {
+        const auto& feature = m_features[f];
+        const auto& labels  = feature.labels();
+        is_cate[f] = feature.type() == feature_type::sclass && std::any_of(labels.begin(), labels.end(), unknown);
+    }
+    const auto has_cate = std::any_of(is_cate.begin(), is_cate.end(), [](const bool cate) { return cate; });
 
-    // load data
-    tensor_size_t sample = 0;
-    for (const auto& csv : m_csvs)
+    const auto collect = [&](const csv_t& csv, const string_t& line, std::vector<strings_t>& labels, auto& seen)
+    {
+        for (auto tokenizer = tokenizer_t{line, csv.m_delim.c_str()}; tokenizer; ++tokenizer)
+        {
+            const auto f     = tokenizer.count() - 1;
+            const auto token = tokenizer.get();
+            if (f < is_cate.size() && is_cate[f] && token != csv.m_placeholder && seen[f].emplace(token).second)
+            {
+                labels[f].emplace_back(token);
+            }
+        }
+    };
+
+    pool.map(parts.size(),
+             [&](const size_t ipart, size_t)
+             {
+                 auto&       part = parts[ipart];
+                 const auto& csv  = m_csvs[part.m_csv];
+
+                 auto seen = std::vector<std::unordered_set<string_t>>(m_features.size());
+                 part.m_labels.resize(m_features.size());
+                 part.m_lines = csv.parse(basedir, part.m_chunk,
+                                          [&](const string_t& line, tensor_size_t)
+                                          {
+                                              ++part.m_samples;
+                                              if (has_cate)
+                                              {
+                                                  collect(csv, line, part.m_labels, seen);
+                                              }
+                                              return true;
+                                          });
+
+                 critical(part.m_lines >= 0, "datasource[", type_id(), "]: failed to read ", csv.m_path, "!");
+             });
+
+    // register the labels in the order of their appearance (as if loading sequentially) and allocate storage
+    auto features    = m_features;
+    auto samples     = tensor_size_t{0};
+    auto csv_samples = std::vector<tensor_size_t>(m_csvs.size(), 0);
+    for (size_t ipart = 0U; ipart < parts.size(); ++ipart)
     {
-        log_info("[", type_id(), "]: reading ", csv.m_path, "...");
+        auto& part = parts[ipart];
+        if (ipart > 0U && parts[ipart - 1U].m_csv == part.m_csv)
+        {
+            part.m_line0 = parts[ipart - 1U].m_line0 + parts[ipart - 1U].m_lines;
+        }
+        part.m_sample0 = samples;
+        samples += part.m_samples;
+        csv_samples[part.m_csv] += part.m_samples;
 
-        const auto old_sample = sample;
-        csv.parse(basedir,
+        for (size_t f = 0U; f < features.size(); ++f)
+        {
+            for (const auto& label : part.m_labels[f])
+            {
+                features[f].set_label(label);
+            }
+        }
+    }
+
+    critical(samples > 0, "datasource[", type_id(), "]: no data to read, check paths!");
+
+    resize(samples, features, m_target);
+
+    // load data:
+    //  - the chunks with enough samples are processed in parallel in two waves,
+    //      so that the chunks processed concurrently do not share the bytes of the feature value masks,
+    //  - the (rare) chunks with few samples are processed sequentially at the end.
+    const auto process = [&](const part_t& part)
+    {
+        const auto& csv    = m_csvs[part.m_csv];
+        auto        sample = part.m_sample0;
+        csv.parse(basedir, part.m_chunk,
                   [&](const string_t& line, tensor_size_t line_index)
                   {
-                      this->parse(csv, line, line_index, sample++);
+                      this->parse(csv, line, part.m_line0 + line_index, sample++);
                       return true;
                   });
+    };
+
+    auto waves = std::array<std::vector<size_t>, 3U>{};
+    for (size_t ipart = 0U, iwave = 0U; ipart < parts.size(); ++ipart)
+    {
+        waves[parts[ipart].m_samples >= 8 ? (iwave++ % 2U) : 2U].push_back(ipart);
+    }
+
+    for (size_t iwave = 0U; iwave < 2U; ++iwave)
+    {
+        const auto& wave = waves[iwave];
+        pool.map(wave.size(), [&](const size_t i, size_t) { process(parts[wave[i]]); });
+    }
+    for (const auto ipart : waves[2U])
+    {
+        process(parts[ipart]);
+    }
+
+    // check the number of samples read per file and mark the testing samples
+    for (size_t icsv = 0U; icsv < m_csvs.size(); ++icsv)
+    {
+        const auto& csv          = m_csvs[icsv];
+        const auto  samples_read = csv_samples[icsv];
+        const auto  old_sample   = std::accumulate(csv_samples.begin(), csv_samples.begin() + icsv, tensor_size_t{0});
 
-        const auto samples_read = sample - old_sample;
         critical(csv.m_expected == 0 || samples_read == csv.m_expected, "datasource[", type_id(), "]: read ",
                  samples_read, ", expecting ", csv.m_expected, " samples!");
 
         datasource_t::testing(make_range(old_sample + csv.m_testing.begin(), old_sample + csv.m_testing.end()));
 
-        log_info("[", type_id(), "]: read ", sample, " samples!");
+        log_info("[", type_id(), "]: read ", samples_read, " samples from ", csv.m_path, "!");
     }
-
-    critical(sample == samples, "datasource[", type_id(), "]: read ", sample, " samples, expecting ", samples, "!");
 }
 
 void tabular_datasource_t::parse(const csv_t& csv, const string_t& line, tensor_size_t line_index, tensor_size_t sample)
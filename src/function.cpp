@@ -43,6 +43,7 @@
 #include <function/nonlinear/trid.h>
 #include <function/nonlinear/zakharov.h>
 
+#include <nano/core/parallel.h>
 #include <nano/core/strutil.h>
 #include <nano/critical.h>
 
@@ -195,6 +196,11 @@ void function_t::strong_convexity(const scalar_t strong_convexity)
     m_strong_convexity = strong_convexity;
 }
 
+void function_t::reentrant(const bool reentrant)
+{
+    m_reentrant = reentrant;
+}
+
 string_t function_t::name(const bool with_size) const
 {
     return with_size ? scat(do_name(), "[", size(), "D]") : do_name();
@@ -281,6 +287,64 @@ tensor_size_t function_t::gcalls() const
     return m_gcalls;
 }
 
+void function_t::hessian_vector(vector_cmap_t x, vector_cmap_t v, vector_map_t Hv) const
+{
+    critical(smooth(), "function: cannot compute the Hessian for non-smooth functions!");
+
+    critical(x.size() == size() && v.size() == size() && Hv.size() == size(),
+             "function: invalid Hessian-vector product sizes, expecting (", size(), ",), got (", x.size(), ",), (",
+             v.size(), ",) and (", Hv.size(), ",) instead!");
+
+    m_hcalls += 1;
+
+    do_hessian_vector(x, v, Hv);
+}
+
+void function_t::do_hessian_vector(vector_cmap_t x, vector_cmap_t v, vector_map_t Hv) const
+{
+    auto Hx = matrix_t{size(), size()};
+    do_eval(eval_t{.m_x = x, .m_hx = Hx});
+
+    Hv.vector() = Hx.matrix() * v.vector();
+}
+
+void function_t::evaluate(matrix_cmap_t xs, vector_map_t fxs, matrix_map_t gxs) const
+{
+    critical(xs.cols() == size(), "function: invalid inputs size, expecting (k, ", size(), "), got (", xs.rows(), ", ",
+             xs.cols(), ") instead!");
+
+    critical(fxs.size() == xs.rows(), "function: invalid values size, expecting (", xs.rows(), ",), got (",
+             fxs.size(), ",) instead!");
+
+    critical(gxs.size() == 0 || gxs.dims() == xs.dims(), "function: invalid gradients size, expecting (", xs.rows(),
+             ", ", size(), ") or empty, got (", gxs.rows(), ", ", gxs.cols(), ") instead!");
+
+    m_fcalls += xs.rows();
+    m_gcalls += (gxs.size() == 0) ? 0 : xs.rows();
+
+    do_evaluate(xs, fxs, gxs);
+}
+
+void function_t::do_evaluate(matrix_cmap_t xs, vector_map_t fxs, matrix_map_t gxs) const
+{
+    const auto op = [&](const tensor_size_t k)
+    { fxs(k) = do_eval(eval_t{.m_x = xs.tensor(k), .m_gx = gxs.size() == 0 ? vector_map_t{} : gxs.tensor(k)}); };
+
+    auto& pool = parallel::scheduler_t::shared();
+    if (m_reentrant && xs.rows() > 1 && pool.size() > 1)
+    {
+        // NB: the points are independent and the function calls are already counted, so evaluate them in parallel.
+        pool.map(xs.rows(), [&](const tensor_size_t k, size_t) { op(k); });
+    }
+    else
+    {
+        for (tensor_size_t k = 0; k < xs.rows(); ++k)
+        {
+            op(k);
+        }
+    }
+}
+
 tensor_size_t function_t::hcalls() const
 {
     return m_hcalls;
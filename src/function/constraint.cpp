@@ -17,6 +17,11 @@ auto smooth(const linear_t&)
     return true;
 }
 
+auto smooth(const sparse_linear_t&)
+{
+    return true;
+}
+
 auto smooth(const constant_t&)
 {
     return true;
@@ -42,6 +47,11 @@ auto strong_convexity(const linear_t&)
     return 0.0;
 }
 
+auto strong_convexity(const sparse_linear_t&)
+{
+    return 0.0;
+}
+
 auto strong_convexity(const constant_t&)
 {
     return 0.0;
@@ -83,6 +93,29 @@ auto eval(const linear_t& constraint, vector_cmap_t x, vector_map_t gx, matrix_m
     return constraint.m_q.dot(x) + constraint.m_r;
 }
 
+auto eval(const sparse_linear_t& constraint, vector_cmap_t x, vector_map_t gx, matrix_map_t hx)
+{
+    if (gx.size() == x.size())
+    {
+        gx.full(0.0);
+        for (tensor_size_t k = 0, size = constraint.m_indices.size(); k < size; ++k)
+        {
+            gx(constraint.m_indices(k)) += constraint.m_values(k);
+        }
+    }
+    if (hx.rows() == x.size() && hx.cols() == x.size())
+    {
+        hx.full(0.0);
+    }
+
+    auto fx = constraint.m_r;
+    for (tensor_size_t k = 0, size = constraint.m_indices.size(); k < size; ++k)
+    {
+        fx += constraint.m_values(k) * x(constraint.m_indices(k));
+    }
+    return fx;
+}
+
 auto eval(const quadratic_t& constraint, vector_cmap_t x, vector_map_t gx, matrix_map_t hx)
 {
     const auto P = constraint.m_P.matrix();
@@ -152,6 +185,11 @@ bool convex(const linear_t&)
     return true;
 }
 
+bool convex(const sparse_linear_t&)
+{
+    return true;
+}
+
 bool convex(const constant_t&)
 {
     return true;
@@ -202,6 +240,16 @@ auto valid(const linear_inequality_t& constraint, vector_cmap_t x)
     return std::max(::eval(constraint, x), 0.0);
 }
 
+auto valid(const sparse_linear_equality_t& constraint, vector_cmap_t x)
+{
+    return std::fabs(::eval(constraint, x, vector_map_t{}, matrix_map_t{}));
+}
+
+auto valid(const sparse_linear_inequality_t& constraint, vector_cmap_t x)
+{
+    return std::max(::eval(constraint, x, vector_map_t{}, matrix_map_t{}), 0.0);
+}
+
 auto valid(const quadratic_equality_t& constraint, vector_cmap_t x)
 {
     return std::fabs(::eval(constraint, x));
@@ -232,6 +280,13 @@ auto compatible(const function_t& function, const linear_t& constraint)
     return constraint.m_q.size() == function.size();
 }
 
+auto compatible(const function_t& function, const sparse_linear_t& constraint)
+{
+    const auto op = [&](const tensor_size_t index) { return index >= 0 && index < function.size(); };
+    return constraint.m_indices.size() == constraint.m_values.size() &&
+           std::all_of(constraint.m_indices.begin(), constraint.m_indices.end(), op);
+}
+
 auto compatible(const function_t& function, const constant_t& constraint)
 {
     return constraint.m_dimension >= 0 && constraint.m_dimension < function.size();
@@ -277,6 +332,7 @@ scalar_t nano::strong_convexity(const constraint_t& constraint)
 {
     return std::visit(overloaded{[&](const euclidean_ball_t& ct) { return ::strong_convexity(ct); },
                                  [&](const linear_t& ct) { return ::strong_convexity(ct); },
+                                 [&](const sparse_linear_t& ct) { return ::strong_convexity(ct); },
                                  [&](const constant_t& ct) { return ::strong_convexity(ct); },
                                  [&](const quadratic_t& ct) { return ::strong_convexity(ct); },
                                  [&](const functional_t& ct) { return ::strong_convexity(ct); }},
@@ -289,6 +345,7 @@ scalar_t nano::eval(const constraint_t& constraint, vector_cmap_t x, vector_map_
         // clang-format off
         overloaded{[&](const euclidean_ball_t& ct) { return ::eval(ct, x, gx, hx); },
                    [&](const linear_t& ct) { return ::eval(ct, x, gx, hx); },
+                   [&](const sparse_linear_t& ct) { return ::eval(ct, x, gx, hx); },
                    [&](const constant_t& ct) { return ::eval(ct, x, gx, hx); },
                    [&](const maximum_t& ct) { return ::eval(ct, x, gx, hx); },
                    [&](const minimum_t& ct) { return ::eval(ct, x, gx, hx); },
@@ -309,6 +366,8 @@ scalar_t nano::valid(const constraint_t& constraint, vector_cmap_t x)
                    [&](const euclidean_ball_inequality_t& ct) { return ::valid(ct, x); },
                    [&](const linear_equality_t& ct) { return ::valid(ct, x); },
                    [&](const linear_inequality_t& ct) { return ::valid(ct, x); },
+                   [&](const sparse_linear_equality_t& ct) { return ::valid(ct, x); },
+                   [&](const sparse_linear_inequality_t& ct) { return ::valid(ct, x); },
                    [&](const quadratic_equality_t& ct) { return ::valid(ct, x); },
                    [&](const quadratic_inequality_t& ct) { return ::valid(ct, x); },
                    [&](const functional_equality_t& ct) { return ::valid(ct, x); },
@@ -323,6 +382,7 @@ bool nano::convex(const constraint_t& constraint)
         // clang-format off
         overloaded{[&](const euclidean_ball_t& ct) { return ::convex(ct); },
                    [&](const linear_t& ct) { return ::convex(ct); },
+                   [&](const sparse_linear_t& ct) { return ::convex(ct); },
                    [&](const constant_t& ct) { return ::convex(ct); },
                    [&](const quadratic_t& ct) { return ::convex(ct); },
                    [&](const functional_t& ct) { return ::convex(ct); }},
@@ -336,6 +396,7 @@ bool nano::smooth(const constraint_t& constraint)
         // clang-format off
         overloaded{[&](const euclidean_ball_t& ct) { return ::smooth(ct); },
                    [&](const linear_t& ct) { return ::smooth(ct); },
+                   [&](const sparse_linear_t& ct) { return ::smooth(ct); },
                    [&](const constant_t& ct) { return ::smooth(ct); },
                    [&](const quadratic_t& ct) { return ::smooth(ct); },
                    [&](const functional_t& ct) { return ::smooth(ct); }},
@@ -347,6 +408,7 @@ bool nano::compatible(const constraint_t& constraint, const function_t& function
 {
     return std::visit(overloaded{[&](const euclidean_ball_t& ct) { return ::compatible(function, ct); },
                                  [&](const linear_t& ct) { return ::compatible(function, ct); },
+                                 [&](const sparse_linear_t& ct) { return ::compatible(function, ct); },
                                  [&](const constant_t& ct) { return ::compatible(function, ct); },
                                  [&](const quadratic_t& ct) { return ::compatible(function, ct); },
                                  [&](const functional_t& ct) { return ::compatible(function, ct); }},
@@ -360,6 +422,8 @@ bool nano::is_equality(const constraint_t& constraint)
                                  [](const maximum_t&) { return false; },                   ///<
                                  [](const linear_equality_t&) { return true; },            ///<
                                  [](const linear_inequality_t&) { return false; },         ///<
+                                 [](const sparse_linear_equality_t&) { return true; },     ///<
+                                 [](const sparse_linear_inequality_t&) { return false; },  ///<
                                  [](const euclidean_ball_equality_t&) { return true; },    ///<
                                  [](const euclidean_ball_inequality_t&) { return false; }, ///<
                                  [](const quadratic_equality_t&) { return true; },         ///<
@@ -376,6 +440,7 @@ bool nano::is_linear(const constraint_t& constraint)
                                  [](const maximum_t&) { return true; },           ///<
                                  [](const linear_equality_t&) { return true; },   ///<
                                  [](const linear_inequality_t&) { return true; }, ///<
+                                 [](const sparse_linear_t&) { return true; },     ///<
                                  [](const euclidean_ball_t&) { return false; },   ///<
                                  [](const quadratic_t&) { return false; },        ///<
                                  [](const functional_t&) { return false; }},      ///<
@@ -41,6 +41,7 @@ function_elasticnet_t<tloss>::function_elasticnet_t(const tensor_size_t dims, co
 
     function_t::convex(tloss::convex ? convexity::yes : convexity::no);
     function_t::smooth((alpha1 == 0.0 && tloss::smooth) ? smoothness::yes : smoothness::no);
+    function_t::reentrant(false);
     function_t::strong_convexity(alpha2);
 }
 
@@ -39,6 +39,7 @@ function_lasso_t<tloss>::function_lasso_t(const tensor_size_t dims, const uint64
 
     function_t::convex(tloss::convex ? convexity::yes : convexity::no);
     function_t::smooth(smoothness::no);
+    function_t::reentrant(false);
     function_t::strong_convexity(0.0);
 }
 
@@ -8,7 +8,8 @@ namespace
 auto is_linear_equality(const constraint_t& constraint)
 {
     return std::get_if<constraint::constant_t>(&constraint) != nullptr ||
-           std::get_if<constraint::linear_equality_t>(&constraint) != nullptr;
+           std::get_if<constraint::linear_equality_t>(&constraint) != nullptr ||
+           std::get_if<constraint::sparse_linear_equality_t>(&constraint) != nullptr;
 }
 
 auto convex(const function_t& function)
@@ -59,6 +60,9 @@ penalty_function_t::penalty_function_t(const function_t& function, const char* c
     // NB: cannot estimate the strong convexity coefficient in general!
     strong_convexity(function.strong_convexity());
 
+    // NB: the wrapped function is shared (e.g. its function calls are counted), so it cannot be evaluated concurrently!
+    reentrant(false);
+
     // NB: no constraints are needed for the penalty function!
 }
 
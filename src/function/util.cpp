@@ -78,14 +78,16 @@ auto is_linear_constrained(const function_t& function)
 
     for (const auto& constraint : function.constraints())
     {
-        std::visit(overloaded{[&](const constant_t&) { ++neqs; },              ///<
-                              [&](const minimum_t&) { ++nineqs; },             ///<
-                              [&](const maximum_t&) { ++nineqs; },             ///<
-                              [&](const linear_equality_t&) { ++neqs; },       ///<
-                              [&](const linear_inequality_t&) { ++nineqs; },   ///<
-                              [&](const euclidean_ball_t&) { valid = false; }, ///<
-                              [&](const quadratic_t&) { valid = false; },      ///<
-                              [&](const functional_t&) { valid = false; }},    ///<
+        std::visit(overloaded{[&](const constant_t&) { ++neqs; },                   ///<
+                              [&](const minimum_t&) { ++nineqs; },                  ///<
+                              [&](const maximum_t&) { ++nineqs; },                  ///<
+                              [&](const linear_equality_t&) { ++neqs; },            ///<
+                              [&](const linear_inequality_t&) { ++nineqs; },        ///<
+                              [&](const sparse_linear_equality_t&) { ++neqs; },     ///<
+                              [&](const sparse_linear_inequality_t&) { ++nineqs; }, ///<
+                              [&](const euclidean_ball_t&) { valid = false; },      ///<
+                              [&](const quadratic_t&) { valid = false; },           ///<
+                              [&](const functional_t&) { valid = false; }},         ///<
                    constraint);
     }
 
@@ -129,6 +131,59 @@ void handle(linear_constraints_t& lc, [[maybe_unused]] tensor_size_t& ieq, [[may
     lc.m_G.row(ineq) = c.m_q.transpose();
     lc.m_h(ineq++)   = -c.m_r;
 }
+
+void handle(linear_constraints_t& lc, [[maybe_unused]] tensor_size_t& ieq, [[maybe_unused]] tensor_size_t& ineq,
+            const sparse_linear_equality_t& c)
+{
+    lc.m_A.row(ieq).array() = 0.0;
+    for (tensor_size_t k = 0, size = c.m_indices.size(); k < size; ++k)
+    {
+        lc.m_A(ieq, c.m_indices(k)) += c.m_values(k);
+    }
+    lc.m_b(ieq++) = -c.m_r;
+}
+
+void handle(linear_constraints_t& lc, [[maybe_unused]] tensor_size_t& ieq, [[maybe_unused]] tensor_size_t& ineq,
+            const sparse_linear_inequality_t& c)
+{
+    lc.m_G.row(ineq).array() = 0.0;
+    for (tensor_size_t k = 0, size = c.m_indices.size(); k < size; ++k)
+    {
+        lc.m_G(ineq, c.m_indices(k)) += c.m_values(k);
+    }
+    lc.m_h(ineq++) = -c.m_r;
+}
+
+using triplet_t  = Eigen::Triplet<scalar_t, tensor_size_t>;
+using triplets_t = std::vector<triplet_t>;
+
+void handle(triplets_t& A, vector_t& b, tensor_size_t& row, const tensor_size_t col, const scalar_t value,
+            const scalar_t rhs)
+{
+    A.emplace_back(row, col, value);
+    b(row++) = rhs;
+}
+
+void handle(triplets_t& A, vector_t& b, tensor_size_t& row, const linear_t& c)
+{
+    for (tensor_size_t col = 0, size = c.m_q.size(); col < size; ++col)
+    {
+        if (c.m_q(col) != 0.0)
+        {
+            A.emplace_back(row, col, c.m_q(col));
+        }
+    }
+    b(row++) = -c.m_r;
+}
+
+void handle(triplets_t& A, vector_t& b, tensor_size_t& row, const sparse_linear_t& c)
+{
+    for (tensor_size_t k = 0, size = c.m_indices.size(); k < size; ++k)
+    {
+        A.emplace_back(row, c.m_indices(k), c.m_values(k));
+    }
+    b(row++) = -c.m_r;
+}
 } // namespace
 
 scalar_t nano::grad_accuracy(const function_t& function, const vector_t& x, const scalar_t early_stopping_epsilon)
@@ -346,17 +401,65 @@ std::optional<linear_constraints_t> nano::make_linear_constraints(const function
 
         for (const auto& constraint : function.constraints())
         {
-            std::visit(overloaded{[&](const constant_t& c) { handle(lc, ieq, ineq, c); },          ///<
-                                  [&](const minimum_t& c) { handle(lc, ieq, ineq, c); },           ///<
-                                  [&](const maximum_t& c) { handle(lc, ieq, ineq, c); },           ///<
-                                  [&](const linear_equality_t& c) { handle(lc, ieq, ineq, c); },   ///<
-                                  [&](const linear_inequality_t& c) { handle(lc, ieq, ineq, c); }, ///<
-                                  [&](const euclidean_ball_t&) {},                                 ///<
-                                  [&](const quadratic_t&) {},                                      ///<
-                                  [&](const functional_t&) {}},                                    ///<
+            std::visit(overloaded{[&](const constant_t& c) { handle(lc, ieq, ineq, c); },                 ///<
+                                  [&](const minimum_t& c) { handle(lc, ieq, ineq, c); },                  ///<
+                                  [&](const maximum_t& c) { handle(lc, ieq, ineq, c); },                  ///<
+                                  [&](const linear_equality_t& c) { handle(lc, ieq, ineq, c); },          ///<
+                                  [&](const linear_inequality_t& c) { handle(lc, ieq, ineq, c); },        ///<
+                                  [&](const sparse_linear_equality_t& c) { handle(lc, ieq, ineq, c); },   ///<
+                                  [&](const sparse_linear_inequality_t& c) { handle(lc, ieq, ineq, c); }, ///<
+                                  [&](const euclidean_ball_t&) {},                                        ///<
+                                  [&](const quadratic_t&) {},                                             ///<
+                                  [&](const functional_t&) {}},                                           ///<
+                       constraint);
+        }
+
+        return lc;
+    }
+}
+
+std::optional<sparse_linear_constraints_t> nano::make_sparse_linear_constraints(const function_t& function)
+{
+    if (const auto [valid, neqs, nineqs] = is_linear_constrained(function); !valid)
+    {
+        return {};
+    }
+
+    else
+    {
+        auto lc = sparse_linear_constraints_t{};
+        lc.m_b  = vector_t{neqs};
+        lc.m_h  = vector_t{nineqs};
+
+        auto ieq  = tensor_size_t{0};
+        auto ineq = tensor_size_t{0};
+        auto A    = triplets_t{};
+        auto G    = triplets_t{};
+
+        for (const auto& constraint : function.constraints())
+        {
+            // clang-format off
+            std::visit(overloaded{[&](const constant_t& c) { handle(A, lc.m_b, ieq, c.m_dimension, +1.0, +c.m_value); },
+                                  [&](const minimum_t& c) { handle(G, lc.m_h, ineq, c.m_dimension, -1.0, -c.m_value); },
+                                  [&](const maximum_t& c) { handle(G, lc.m_h, ineq, c.m_dimension, +1.0, +c.m_value); },
+                                  [&](const linear_equality_t& c) { handle(A, lc.m_b, ieq, c); },
+                                  [&](const linear_inequality_t& c) { handle(G, lc.m_h, ineq, c); },
+                                  [&](const sparse_linear_equality_t& c) { handle(A, lc.m_b, ieq, c); },
+                                  [&](const sparse_linear_inequality_t& c) { handle(G, lc.m_h, ineq, c); },
+                                  [&](const euclidean_ball_t&) {},
+                                  [&](const quadratic_t&) {},
+                                  [&](const functional_t&) {}},
                        constraint);
+            // clang-format on
         }
 
+        // NB: the duplicated coefficients (if any) are summed up.
+        lc.m_A.resize(neqs, function.size());
+        lc.m_A.setFromTriplets(A.begin(), A.end());
+
+        lc.m_G.resize(nineqs, function.size());
+        lc.m_G.setFromTriplets(G.begin(), G.end());
+
         return lc;
     }
 }
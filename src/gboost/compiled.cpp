@@ -0,0 +1,388 @@
+#include <nano/critical.h>
+#include <nano/gboost/compiled.h>
+#include <nano/wlearner/affine.h>
+#include <nano/wlearner/dtree.h>
+#include <nano/wlearner/hinge.h>
+#include <nano/wlearner/stump.h>
+#include <nano/wlearner/table.h>
+
+using namespace nano;
+using namespace nano::gboost;
+
+namespace
+{
+constexpr auto block_size = tensor_size_t{256};
+
+///
+/// \brief accumulate the lowered decision nodes and leaves.
+///
+class builder_t
+{
+public:
+    explicit builder_t(const tensor_size_t outputs)
+        : m_outputs(outputs)
+    {
+        // the first leaf is empty (no contribution)
+        m_weights.resize(static_cast<size_t>(m_outputs), 0.0);
+        m_biases.resize(static_cast<size_t>(m_outputs), 0.0);
+    }
+
+    static tensor_size_t empty() { return -1; }
+
+    tensor_size_t node(const tensor_size_t feature, const scalar_t threshold)
+    {
+        m_nfeatures.push_back(column(feature));
+        m_thresholds.push_back(threshold);
+        m_children.push_back(empty());
+        m_children.push_back(empty());
+        return static_cast<tensor_size_t>(m_thresholds.size()) - 1;
+    }
+
+    void children(const tensor_size_t node, const tensor_size_t left, const tensor_size_t right)
+    {
+        m_children[static_cast<size_t>(2 * node + 0)] = left;
+        m_children[static_cast<size_t>(2 * node + 1)] = right;
+    }
+
+    template <class tweights, class tbiases>
+    tensor_size_t leaf(const tweights& weights, const tbiases& biases)
+    {
+        assert(weights.size() == m_outputs);
+        assert(biases.size() == m_outputs);
+
+        const auto leaf = static_cast<tensor_size_t>(m_weights.size()) / m_outputs;
+        m_weights.insert(m_weights.end(), weights.begin(), weights.end());
+        m_biases.insert(m_biases.end(), biases.begin(), biases.end());
+        return -1 - leaf;
+    }
+
+    template <class tbiases>
+    tensor_size_t leaf(const tbiases& biases)
+    {
+        return leaf(make_full_tensor<scalar_t>(make_dims(m_outputs), 0.0), biases);
+    }
+
+    void root(const tensor_size_t node) { m_roots.push_back(node); }
+
+    void lookup(const tensor_size_t feature, const std::vector<tensor_size_t>& leaves)
+    {
+        m_lfeatures.push_back(column(feature));
+        m_loffsets.push_back(static_cast<tensor_size_t>(m_lleaves.size()));
+        m_lleaves.insert(m_lleaves.end(), leaves.begin(), leaves.end());
+    }
+
+    void build(indices_t& features, indices_t& roots, indices_t& nfeatures, tensor1d_t& thresholds,
+               indices_t& children, tensor2d_t& weights, tensor2d_t& biases, indices_t& lfeatures,
+               indices_t& loffsets, indices_t& lleaves) const
+    {
+        const auto leaves = static_cast<tensor_size_t>(m_weights.size()) / std::max(m_outputs, tensor_size_t{1});
+
+        features   = map_tensor(m_features.data(), static_cast<tensor_size_t>(m_features.size()));
+        roots      = map_tensor(m_roots.data(), static_cast<tensor_size_t>(m_roots.size()));
+        nfeatures  = map_tensor(m_nfeatures.data(), static_cast<tensor_size_t>(m_nfeatures.size()));
+        thresholds = map_tensor(m_thresholds.data(), static_cast<tensor_size_t>(m_thresholds.size()));
+        children   = map_tensor(m_children.data(), static_cast<tensor_size_t>(m_children.size()));
+        weights    = map_tensor(m_weights.data(), leaves, m_outputs);
+        biases     = map_tensor(m_biases.data(), leaves, m_outputs);
+
+        lfeatures = map_tensor(m_lfeatures.data(), static_cast<tensor_size_t>(m_lfeatures.size()));
+        lleaves   = map_tensor(m_lleaves.data(), static_cast<tensor_size_t>(m_lleaves.size()));
+        loffsets.resize(static_cast<tensor_size_t>(m_loffsets.size()) + 1);
+        for (size_t i = 0U; i < m_loffsets.size(); ++i)
+        {
+            loffsets(static_cast<tensor_size_t>(i)) = m_loffsets[i];
+        }
+        loffsets(loffsets.size() - 1) = static_cast<tensor_size_t>(m_lleaves.size());
+    }
+
+private:
+    tensor_size_t column(const tensor_size_t feature)
+    {
+        auto it = std::find(m_features.begin(), m_features.end(), feature);
+        if (it == m_features.end())
+        {
+            it = m_features.insert(it, feature);
+        }
+        return static_cast<tensor_size_t>(std::distance(m_features.begin(), it));
+    }
+
+    // attributes
+    tensor_size_t              m_outputs{0}; ///<
+    std::vector<tensor_size_t> m_features;   ///<
+    std::vector<tensor_size_t> m_roots;      ///<
+    std::vector<tensor_size_t> m_nfeatures;  ///<
+    std::vector<scalar_t>      m_thresholds; ///<
+    std::vector<tensor_size_t> m_children;   ///<
+    std::vector<scalar_t>      m_weights;    ///<
+    std::vector<scalar_t>      m_biases;     ///<
+    std::vector<tensor_size_t> m_lfeatures;  ///<
+    std::vector<tensor_size_t> m_loffsets;   ///<
+    std::vector<tensor_size_t> m_lleaves;    ///<
+};
+
+bool lowerable(const dtree_wlearner_t& wlearner)
+{
+    const auto& nodes = wlearner.nodes();
+    if (nodes.empty())
+    {
+        return false;
+    }
+
+    // NB: the children of a splitting node are the following node pair, so they must be stored afterwards.
+    for (size_t i = 0; i < nodes.size(); i += 2U)
+    {
+        const auto& node = nodes[i];
+        if (node.m_feature < 0 || i + 1U >= nodes.size())
+        {
+            return false;
+        }
+        if (node.m_next != 0U && (nodes[i + 1U].m_next <= i + 1U || node.m_next <= i + 1U ||
+                                  node.m_next >= nodes.size() || nodes[i + 1U].m_next >= nodes.size()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+tensor_size_t lower(builder_t& builder, const dtree_wlearner_t& wlearner, const size_t inode)
+{
+    const auto& nodes  = wlearner.nodes();
+    const auto& tables = wlearner.tables();
+    const auto& dnode  = nodes[inode];
+
+    const auto node = builder.node(dnode.m_feature, dnode.m_threshold);
+
+    tensor_size_t children[2]; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+    for (size_t group = 0U; group < 2U; ++group)
+    {
+        // terminal node
+        if (dnode.m_next == 0U)
+        {
+            const auto table  = dnode.m_table + static_cast<tensor_size_t>(group);
+            children[group] = table >= 0 ? builder.leaf(tables.vector(table)) : builder_t::empty();
+        }
+
+        // split node
+        else
+        {
+            children[group] = lower(builder, wlearner, nodes[inode + group].m_next);
+        }
+    }
+
+    builder.children(node, children[0], children[1]);
+    return node;
+}
+
+bool lower(builder_t& builder, const features_t& inputs, const wlearner_t& wlearner)
+{
+    if (const auto* const stump = dynamic_cast<const stump_wlearner_t*>(&wlearner);
+        stump != nullptr && stump->feature() >= 0)
+    {
+        const auto node = builder.node(stump->feature(), stump->threshold());
+        builder.children(node, builder.leaf(stump->vector(0)), builder.leaf(stump->vector(1)));
+        builder.root(node);
+        return true;
+    }
+
+    if (const auto* const hinge = dynamic_cast<const hinge_wlearner_t*>(&wlearner);
+        hinge != nullptr && hinge->feature() >= 0)
+    {
+        const auto node = builder.node(hinge->feature(), hinge->threshold());
+        const auto leaf = builder.leaf(hinge->vector(0), hinge->vector(1));
+        if (hinge->hinge() == hinge_type::left)
+        {
+            builder.children(node, leaf, builder_t::empty());
+        }
+        else
+        {
+            builder.children(node, builder_t::empty(), leaf);
+        }
+        builder.root(node);
+        return true;
+    }
+
+    if (const auto* const affine = dynamic_cast<const affine_wlearner_t*>(&wlearner);
+        affine != nullptr && affine->feature() >= 0)
+    {
+        // NB: all finite feature values are smaller than the threshold, so the left leaf is always taken.
+        const auto node = builder.node(affine->feature(), std::numeric_limits<scalar_t>::infinity());
+        builder.children(node, builder.leaf(affine->vector(0), affine->vector(1)), builder_t::empty());
+        builder.root(node);
+        return true;
+    }
+
+    if (const auto* const dtree = dynamic_cast<const dtree_wlearner_t*>(&wlearner);
+        dtree != nullptr && lowerable(*dtree))
+    {
+        builder.root(lower(builder, *dtree, 0U));
+        return true;
+    }
+
+    if (const auto* const table = dynamic_cast<const table_wlearner_t*>(&wlearner);
+        table != nullptr && table->feature() >= 0 && table->feature() < static_cast<tensor_size_t>(inputs.size()) &&
+        inputs[static_cast<size_t>(table->feature())].is_sclass())
+    {
+        // NB: the hash of a single-label categorical feature value is the label index.
+        const auto& hashes      = table->hashes();
+        const auto& hash2tables = table->hash2tables();
+        const auto& tables      = table->tables();
+        const auto  classes     = inputs[static_cast<size_t>(table->feature())].classes();
+
+        auto tleaves = std::vector<tensor_size_t>(static_cast<size_t>(tables.size<0>()), builder_t::empty());
+        auto lleaves = std::vector<tensor_size_t>(static_cast<size_t>(classes), builder_t::empty());
+        for (tensor_size_t i = 0; i < hashes.size(); ++i)
+        {
+            const auto label = static_cast<tensor_size_t>(hashes(i));
+            const auto itab  = static_cast<size_t>(hash2tables(i));
+            if (label < classes)
+            {
+                if (tleaves[itab] == builder_t::empty())
+                {
+                    tleaves[itab] = builder.leaf(tables.vector(hash2tables(i)));
+                }
+                lleaves[static_cast<size_t>(label)] = tleaves[itab];
+            }
+        }
+
+        builder.lookup(table->feature(), lleaves);
+        return true;
+    }
+
+    return false;
+}
+
+struct buffer_t
+{
+    scalar_mem_t m_fvalues; ///< buffer to gather the values of a scalar feature
+    sclass_mem_t m_svalues; ///< buffer to gather the values of a single-label categorical feature
+    tensor2d_t   m_values;  ///< gathered feature values (#samples, #features)
+};
+} // namespace
+
+compiled_model_t::compiled_model_t() = default;
+
+compiled_model_t::compiled_model_t(const features_t& inputs, const tensor1d_t& bias, const rwlearners_t& wlearners)
+    : m_bias(bias)
+{
+    auto builder = builder_t{bias.size()};
+    for (const auto& wlearner : wlearners)
+    {
+        if (!lower(builder, inputs, *wlearner))
+        {
+            m_fallbacks.emplace_back(wlearner->clone());
+        }
+    }
+
+    builder.build(m_features, m_roots, m_nfeatures, m_thresholds, m_children, m_weights, m_biases, m_lfeatures,
+                  m_loffsets, m_lleaves);
+}
+
+template <class tvalues, class toutput>
+void compiled_model_t::evaluate(const tvalues& values, toutput&& output) const
+{
+    for (const auto root : m_roots)
+    {
+        for (auto node = root; node >= 0;)
+        {
+            const auto value = values(m_nfeatures(node));
+            if (!std::isfinite(value))
+            {
+                break;
+            }
+
+            const auto child = m_children(2 * node + (value < m_thresholds(node) ? 0 : 1));
+            if (child < -1)
+            {
+                const auto leaf = -1 - child;
+                output += value * m_weights.vector(leaf) + m_biases.vector(leaf);
+            }
+            node = child;
+        }
+    }
+
+    for (tensor_size_t lookup = 0; lookup < m_lfeatures.size(); ++lookup)
+    {
+        const auto value = values(m_lfeatures(lookup));
+        const auto begin = m_loffsets(lookup);
+        const auto end   = m_loffsets(lookup + 1);
+        if (std::isfinite(value) && value >= 0.0 && value < static_cast<scalar_t>(end - begin))
+        {
+            const auto child = m_lleaves(begin + static_cast<tensor_size_t>(value));
+            if (child < -1)
+            {
+                output += m_biases.vector(-1 - child);
+            }
+        }
+    }
+}
+
+void compiled_model_t::predict(const dataset_t& dataset, indices_cmap_t samples, tensor4d_map_t outputs) const
+{
+    auto omatrix = outputs.reshape(samples.size(), -1);
+
+    omatrix.matrix().rowwise() = m_bias.vector().transpose();
+
+    if (m_features.size() > 0)
+    {
+        auto buffers = std::vector<buffer_t>(dataset.concurrency());
+
+        dataset.thread_pool().map(
+            samples.size(), block_size,
+            [&](const tensor_size_t begin, const tensor_size_t end, const size_t tnum)
+            {
+                assert(tnum < buffers.size());
+
+                auto& buffer = buffers[tnum];
+                auto& values = buffer.m_values;
+
+                // gather once the values of the used features
+                values.resize(end - begin, m_features.size());
+                for (tensor_size_t f = 0; f < m_features.size(); ++f)
+                {
+                    const auto fsamples = samples.slice(begin, end);
+                    if (dataset.feature(m_features(f)).is_sclass())
+                    {
+                        const auto svalues = dataset.select(fsamples, m_features(f), buffer.m_svalues);
+                        for (tensor_size_t i = 0; i < end - begin; ++i)
+                        {
+                            values(i, f) = svalues(i) >= 0 ? static_cast<scalar_t>(svalues(i))
+                                                          : std::numeric_limits<scalar_t>::quiet_NaN();
+                        }
+                    }
+                    else
+                    {
+                        const auto fvalues = dataset.select(fsamples, m_features(f), buffer.m_fvalues);
+                        for (tensor_size_t i = 0; i < end - begin; ++i)
+                        {
+                            values(i, f) = fvalues(i);
+                        }
+                    }
+                }
+
+                // evaluate the lowered weak learners in one pass
+                for (tensor_size_t i = 0; i < end - begin; ++i)
+                {
+                    evaluate([&](const tensor_size_t f) { return values(i, f); }, omatrix.vector(begin + i));
+                }
+            });
+    }
+
+    for (const auto& wlearner : m_fallbacks)
+    {
+        wlearner->predict(dataset, samples, outputs);
+    }
+}
+
+void compiled_model_t::score(tensor2d_cmap_t rows, tensor4d_map_t outputs) const
+{
+    critical(m_fallbacks.empty(), "gboost: cannot score rows of feature values with weak learners not lowered (",
+             m_fallbacks.size(), ")!");
+
+    auto omatrix = outputs.reshape(rows.size<0>(), -1);
+    for (tensor_size_t i = 0; i < rows.size<0>(); ++i)
+    {
+        omatrix.vector(i) = m_bias.vector();
+        evaluate([&](const tensor_size_t f) { return rows(i, m_features(f)); }, omatrix.vector(i));
+    }
+}
@@ -11,10 +11,11 @@ grads_function_t::grads_function_t(const targets_iterator_t& iterator, const los
     , m_loss(loss)
     , m_values(iterator.samples().size())
     , m_vgrads(cat_dims(iterator.samples().size(), iterator.dataset().target_dims()))
-    , m_vhesss(loss_t::make_hess_dims(iterator.samples().size(), iterator.dataset().target_dims()))
+    , m_vhesss(iterator.concurrency())
 {
     smooth(loss.smooth() ? smoothness::yes : smoothness::no);
     convex(loss.convex() ? convexity::yes : convexity::no);
+    reentrant(false);
 }
 
 rfunction_t grads_function_t::clone() const
@@ -28,20 +29,42 @@ scalar_t grads_function_t::do_eval(eval_t eval) const
     const auto  tsize   = ::nano::size(m_iterator.dataset().target_dims());
     const auto  odims   = cat_dims(samples.size(), m_iterator.dataset().target_dims());
     const auto  denom   = static_cast<scalar_t>(samples.size());
+    const auto  outputs = map_tensor(eval.m_x.data(), odims);
 
-    const auto& grads = gradients(map_tensor(eval.m_x.data(), odims));
-    if (eval.has_grad())
+    if (!eval.has_hess())
     {
-        eval.m_gx = grads.vector() / denom;
+        const auto& grads = gradients(outputs);
+        if (eval.has_grad())
+        {
+            eval.m_gx = grads.vector() / denom;
+        }
     }
-    if (eval.has_hess())
+    else
     {
+        // the full hessians are computed on demand per batch (thread) and copied to the block-diagonal hessian
         eval.m_hx.full(0.0);
 
-        for (tensor_size_t sample = 0; sample < samples.size(); ++sample)
+        m_iterator.loop(
+            [&](const tensor_range_t& range, const size_t tnum, const tensor4d_cmap_t& targets)
+            {
+                assert(tnum < m_vhesss.size());
+                auto& vhesss = m_vhesss[tnum];
+
+                vhesss.resize(loss_t::make_hess_dims(targets));
+                m_loss.eval(targets, outputs.slice(range), m_values.slice(range), m_vgrads.slice(range),
+                            vhesss.tensor());
+
+                for (tensor_size_t k = 0; k < range.size(); ++k)
+                {
+                    const auto sample = range.begin() + k;
+                    eval.m_hx.matrix().block(sample * tsize, sample * tsize, tsize, tsize) =
+                        vhesss.tensor(k).reshape(tsize, tsize).matrix() / denom;
+                }
+            });
+
+        if (eval.has_grad())
         {
-            eval.m_hx.matrix().block(sample * tsize, sample * tsize, tsize, tsize) =
-                m_vhesss.tensor(sample).reshape(tsize, tsize).matrix() / denom;
+            eval.m_gx = m_vgrads.vector() / denom;
         }
     }
 
@@ -49,17 +72,37 @@ scalar_t grads_function_t::do_eval(eval_t eval) const
     return m_values.vector().mean();
 }
 
-const tensor4d_t& grads_function_t::gradients(const tensor4d_cmap_t& outputs) const
+const tensor4d_t& grads_function_t::gradients(const tensor4d_cmap_t& outputs, const bool diag_hessians) const
 {
     assert(outputs.dims() == m_vgrads.dims());
 
-    m_iterator.loop(
-        [&](const tensor_range_t& range, size_t, const tensor4d_cmap_t& targets)
-        {
-            m_loss.value(targets, outputs.slice(range), m_values.slice(range));
-            m_loss.vgrad(targets, outputs.slice(range), m_vgrads.slice(range));
-            m_loss.vhess(targets, outputs.slice(range), m_vhesss.slice(range));
-        });
+    if (!diag_hessians)
+    {
+        m_iterator.loop(
+            [&](const tensor_range_t& range, size_t, const tensor4d_cmap_t& targets)
+            { m_loss.eval(targets, outputs.slice(range), m_values.slice(range), m_vgrads.slice(range)); });
+    }
+    else
+    {
+        const auto tsize = ::nano::size(m_iterator.dataset().target_dims());
+
+        m_vhdiags.resize(m_vgrads.dims());
+        m_iterator.loop(
+            [&](const tensor_range_t& range, const size_t tnum, const tensor4d_cmap_t& targets)
+            {
+                assert(tnum < m_vhesss.size());
+                auto& vhesss = m_vhesss[tnum];
+
+                vhesss.resize(loss_t::make_hess_dims(targets));
+                m_loss.eval(targets, outputs.slice(range), m_values.slice(range), m_vgrads.slice(range),
+                            vhesss.tensor());
+
+                for (tensor_size_t k = 0; k < range.size(); ++k)
+                {
+                    m_vhdiags.vector(range.begin() + k) = vhesss.tensor(k).reshape(tsize, tsize).matrix().diagonal();
+                }
+            });
+    }
 
     return m_vgrads;
 }
@@ -72,6 +115,7 @@ bias_function_t::bias_function_t(const targets_iterator_t& iterator, const loss_
 {
     smooth(loss.smooth() ? smoothness::yes : smoothness::no);
     convex(loss.convex() ? convexity::yes : convexity::no);
+    reentrant(false);
 }
 
 rfunction_t bias_function_t::clone() const
@@ -98,14 +142,14 @@ scalar_t bias_function_t::do_eval(eval_t eval) const
             accumulator.m_outputs.reshape(range.size(), -1).matrix().rowwise() = eval.m_x.transpose();
 
             // cumulate values
-            m_loss.value(targets, accumulator.m_outputs, accumulator.m_loss_fx);
+            m_loss.eval(targets, accumulator.m_outputs, accumulator.m_loss_fx,
+                        eval.has_grad() ? &accumulator.m_loss_gx : nullptr,
+                        eval.has_hess() ? &accumulator.m_loss_hx : nullptr);
             accumulator.m_fx += accumulator.m_loss_fx.sum();
 
             // cumulate gradients
             if (eval.has_grad())
             {
-                m_loss.vgrad(targets, accumulator.m_outputs, accumulator.m_loss_gx);
-
                 const auto gmatrix = accumulator.m_loss_gx.reshape(range.size(), tsize);
                 accumulator.m_gx += gmatrix.matrix().colwise().sum().transpose();
             }
@@ -113,8 +157,6 @@ scalar_t bias_function_t::do_eval(eval_t eval) const
             // cumulate hessians
             if (eval.has_hess())
             {
-                m_loss.vhess(targets, accumulator.m_outputs, accumulator.m_loss_hx);
-
                 const auto hmatrix = accumulator.m_loss_hx.reshape(range.size(), tsize * tsize);
                 accumulator.m_hx.array() += hmatrix.matrix().colwise().sum().array();
             }
@@ -140,6 +182,7 @@ scale_function_t::scale_function_t(const targets_iterator_t& iterator, const los
 
     smooth(loss.smooth() ? smoothness::yes : smoothness::no);
     convex(loss.convex() ? convexity::yes : convexity::no);
+    reentrant(false);
 }
 
 rfunction_t scale_function_t::clone() const
@@ -176,14 +219,14 @@ scalar_t scale_function_t::do_eval(eval_t eval) const
             }
 
             // cumulate values
-            m_loss.value(targets, accumulator.m_outputs, accumulator.m_loss_fx);
+            m_loss.eval(targets, accumulator.m_outputs, accumulator.m_loss_fx,
+                        eval.has_grad() ? &accumulator.m_loss_gx : nullptr,
+                        eval.has_hess() ? &accumulator.m_loss_hx : nullptr);
             accumulator.m_fx += accumulator.m_loss_fx.sum();
 
             // cumulate gradients
             if (eval.has_grad())
             {
-                m_loss.vgrad(targets, accumulator.m_outputs, accumulator.m_loss_gx);
-
                 for (tensor_size_t i = begin; i < end; ++i)
                 {
                     const auto group = m_cluster.group(samples(i));
@@ -201,8 +244,6 @@ scalar_t scale_function_t::do_eval(eval_t eval) const
             // cumulate hessians
             if (eval.has_hess())
             {
-                m_loss.vhess(targets, accumulator.m_outputs, accumulator.m_loss_hx);
-
                 for (tensor_size_t i = begin; i < end; ++i)
                 {
                     const auto group = m_cluster.group(samples(i));
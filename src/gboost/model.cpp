@@ -218,6 +218,7 @@ gboost_model_t::gboost_model_t(const gboost_model_t& other)
     , m_bias(other.m_bias)
     , m_wlearners(wlearner::clone(other.m_wlearners))
     , m_prototypes(wlearner::clone(other.m_prototypes))
+    , m_compiled(other.inputs(), m_bias, m_wlearners)
 {
 }
 
@@ -229,6 +230,7 @@ gboost_model_t& gboost_model_t::operator=(const gboost_model_t& other)
         m_bias       = other.m_bias;
         m_wlearners  = wlearner::clone(other.m_wlearners);
         m_prototypes = wlearner::clone(other.m_prototypes);
+        m_compiled   = compiled_model_t{inputs(), m_bias, m_wlearners};
     }
     return *this;
 }
@@ -252,6 +254,8 @@ std::istream& gboost_model_t::read(std::istream& stream)
     critical(::nano::read(stream, m_bias) && ::nano::read(stream, m_wlearners) && ::nano::read(stream, m_prototypes),
              "gboost: failed to read from stream!");
 
+    m_compiled = compiled_model_t{inputs(), m_bias, m_wlearners};
+
     return stream;
 }
 
@@ -280,7 +284,8 @@ ml::result_t gboost_model_t::fit(const dataset_t& dataset, const indices_t& samp
         return std::make_tuple(std::move(train_errors_losses), std::move(valid_errors_losses), std::move(gboost));
     };
 
-    auto fit_result = ml::tune("gboost", samples, fit_params, ::make_params(*this), callback);
+    auto fit_result =
+        ml::tune("gboost", samples, fit_params, ::make_params(*this), callback, dataset.thread_pool());
 
     // choose the optimum hyper-parameters and merge the boosters fitted for each fold
     {
@@ -310,6 +315,7 @@ ml::result_t gboost_model_t::fit(const dataset_t& dataset, const indices_t& samp
         }
 
         learner_t::fit_dataset(dataset);
+        m_compiled = compiled_model_t{inputs(), m_bias, m_wlearners};
 
         const auto all_samples = arange(0, dataset.samples());
         const auto outputs     = predict(dataset, all_samples);
@@ -330,12 +336,19 @@ ml::result_t gboost_model_t::fit(const dataset_t& dataset, const indices_t& samp
 
 void gboost_model_t::do_predict(const dataset_t& dataset, indices_cmap_t samples, tensor4d_map_t outputs) const
 {
-    outputs.reshape(samples.size(), -1).matrix().rowwise() = m_bias.vector().transpose();
+    m_compiled.predict(dataset, samples, outputs);
+}
 
-    for (const auto& wlearner : m_wlearners)
-    {
-        wlearner->predict(dataset, samples, outputs.tensor());
-    }
+void gboost_model_t::score(tensor2d_cmap_t rows, tensor4d_map_t outputs) const
+{
+    critical(rows.size<1>() == static_cast<tensor_size_t>(inputs().size()), "gboost: mis-matching number of inputs (",
+             rows.size<1>(), "), expecting (", inputs().size(), ")!");
+
+    critical(outputs.size<0>() == rows.size<0>() && outputs.size() == rows.size<0>() * m_bias.size(),
+             "gboost: mis-matching outputs (", outputs.dims(), "), expecting (", rows.size<0>(), "x", m_bias.size(),
+             ")!");
+
+    m_compiled.score(rows, outputs);
 }
 
 indices_t gboost_model_t::features() const
@@ -87,6 +87,35 @@ void generator_t::flatten_dropped(tensor2d_map_t storage, const tensor_size_t co
     storage.matrix().block(0, column, samples, colsize).array() = NaN;
 }
 
+bool generator_t::contiguous(indices_cmap_t samples)
+{
+    for (tensor_size_t i = 1; i < samples.size(); ++i)
+    {
+        if (samples(i) != samples(i - 1) + 1)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+scalar_view_t generator_t::view(indices_cmap_t samples, const tensor_size_t ifeature) const
+{
+    if (should_drop(ifeature) || shuffled(ifeature).size() > 0 || samples.size() == 0 || !contiguous(samples))
+    {
+        return scalar_view_t{};
+    }
+    else
+    {
+        return do_view(samples, ifeature);
+    }
+}
+
+scalar_view_t generator_t::do_view(indices_cmap_t, tensor_size_t) const
+{
+    return scalar_view_t{};
+}
+
 const datasource_t& generator_t::datasource() const
 {
     critical(m_datasource != nullptr, "generator: cannot access the dataset before fitting!");
@@ -27,13 +27,27 @@ auto make_x0(const ::nano::linear::function_t& function, const std::any& extra)
     return x0;
 } // LCOV_EXCL_LINE
 
+auto cache_sparse(flatten_iterator_t& iterator)
+{
+    // NB: use the hybrid dense-sparse representation only if it needs at most half the memory of the dense one
+    const auto& dataset = iterator.dataset();
+    const auto  bytes   = static_cast<tensor_size_t>(sizeof(scalar_t)) * iterator.samples().size() * dataset.columns();
+
+    return dataset.sparse_columns().size() > 0 && iterator.cache_sparse(bytes / 2);
+}
+
 auto fit(const linear_t& model, const dataset_t& dataset, const indices_t& samples, const loss_t& loss,
-         const solver_t& solver, tensor1d_cmap_t params, const logger_t& logger, const std::any& extra = std::any{})
+         const solver_t& solver, tensor1d_cmap_t params, const logger_t& logger, const rflatten_cache_t& cache,
+         const std::any& extra = std::any{})
 {
     auto iterator = flatten_iterator_t{dataset, samples};
     iterator.batch(model.parameter("linear::batch").value<tensor_size_t>());
     iterator.scaling(model.parameter("linear::scaling").value<scaling_type>());
-    iterator.cache_flatten(std::numeric_limits<tensor_size_t>::max());
+    iterator.precision(model.parameter("linear::precision").value<precision_type>());
+    if (!cache_sparse(iterator) && !iterator.cache_flatten(cache))
+    {
+        iterator.cache_flatten(std::numeric_limits<tensor_size_t>::max());
+    }
     iterator.cache_targets(std::numeric_limits<tensor_size_t>::max());
 
     const auto function = model.make_function(iterator, loss, params);
@@ -53,6 +67,7 @@ linear_t::linear_t(string_t id)
 {
     register_parameter(parameter_t::make_integer("linear::batch", 10, LE, 100, LE, 10000));
     register_parameter(parameter_t::make_enum("linear::scaling", scaling_type::standard));
+    register_parameter(parameter_t::make_enum("linear::precision", precision_type::float64));
 }
 
 std::istream& linear_t::read(std::istream& stream)
@@ -80,26 +95,30 @@ ml::result_t linear_t::fit(const dataset_t& dataset, const indices_t& samples, c
 {
     learner_t::fit_dataset(dataset);
 
-    const auto batch = parameter("linear::batch").value<tensor_size_t>();
+    const auto batch     = parameter("linear::batch").value<tensor_size_t>();
+    const auto precision = parameter("linear::precision").value<precision_type>();
+
+    // cache the flatten feature values once for all folds and trials (scaled on the fly with the fold statistics)
+    const auto cache = std::make_shared<const flatten_cache_t>(dataset, samples, precision, batch);
 
     // tune hyper-parameters (if any)
     const auto callback = [&](const indices_t& train_samples, const indices_t& valid_samples,
                               const tensor1d_cmap_t params, const std::any& extra, const logger_t& logger)
     {
-        auto result    = ::fit(*this, dataset, train_samples, loss, fit_params.solver(), params, logger, extra);
+        auto result    = ::fit(*this, dataset, train_samples, loss, fit_params.solver(), params, logger, cache, extra);
         auto tr_values = ::nano::linear::evaluate(dataset, train_samples, loss, result.m_weights, result.m_bias, batch);
         auto vd_values = ::nano::linear::evaluate(dataset, valid_samples, loss, result.m_weights, result.m_bias, batch);
 
         return std::make_tuple(std::move(tr_values), std::move(vd_values), std::move(result));
     };
-    auto fit_result = ml::tune("linear", samples, fit_params, make_param_spaces(), callback);
+    auto fit_result = ml::tune("linear", samples, fit_params, make_param_spaces(), callback, dataset.thread_pool());
 
     // refit with the optimum hyper-parameters (if any) on all given samples
     {
         const auto logger = make_file_logger(fit_result.refit_log_path());
         const auto params = fit_result.params(fit_result.optimum_trial());
 
-        auto result = ::fit(*this, dataset, samples, loss, fit_params.solver(), params, logger);
+        auto result = ::fit(*this, dataset, samples, loss, fit_params.solver(), params, logger, cache);
         auto values = ::nano::linear::evaluate(dataset, samples, loss, result.m_weights, result.m_bias, batch);
 
         m_bias    = result.m_bias;
@@ -119,8 +138,31 @@ void linear_t::do_predict(const dataset_t& dataset, indices_cmap_t samples, tens
     iterator.scaling(scaling_type::none);
     iterator.batch(parameter("linear::batch").value<tensor_size_t>());
 
-    iterator.loop([&](tensor_range_t range, size_t, tensor2d_cmap_t inputs)
-                  { ::nano::linear::predict(inputs, m_weights, m_bias, outputs.slice(range)); });
+    if (dataset.sparse_columns().size() > 0)
+    {
+        iterator.loop([&](tensor_range_t range, size_t, const sparse_flatten_t& inputs)
+                      { ::nano::linear::predict(inputs, m_weights, m_bias, outputs.slice(range)); });
+    }
+    else
+    {
+        iterator.loop([&](tensor_range_t range, size_t, tensor2d_cmap_t inputs)
+                      { ::nano::linear::predict(inputs, m_weights, m_bias, outputs.slice(range)); });
+    }
+}
+
+void linear_t::score(tensor2d_cmap_t rows, tensor4d_map_t outputs) const
+{
+    critical(rows.size<1>() == m_weights.cols(), "linear: mis-matching number of flatten inputs (", rows.size<1>(),
+             "), expecting (", m_weights.cols(), ")!");
+
+    critical(outputs.size<0>() == rows.size<0>() && outputs.size() == rows.size<0>() * m_bias.size(),
+             "linear: mis-matching outputs (", outputs.dims(), "), expecting (", rows.size<0>(), "x", m_bias.size(),
+             ")!");
+
+    auto omatrix = outputs.reshape(rows.size<0>(), m_bias.size()).matrix();
+
+    omatrix.noalias() = rows.matrix() * m_weights.matrix().transpose();
+    omatrix.rowwise() += m_bias.vector().transpose();
 }
 
 factory_t<linear_t>& linear_t::all()
@@ -7,13 +7,29 @@ accumulator_t::accumulator_t() = default;
 accumulator_t::accumulator_t(const tensor_size_t isize, const tensor_size_t tsize)
     : m_gb(tsize)
     , m_gw(tsize, isize)
-    , m_hww(tsize * isize, tsize * isize)
-    , m_hwb(tsize * isize, tsize)
-    , m_hbb(tsize, tsize)
 {
     clear();
 }
 
+void accumulator_t::hessian(const bool enable)
+{
+    const auto tsize = m_gw.size<0>();
+    const auto isize = m_gw.size<1>();
+
+    if (!enable)
+    {
+        m_hww.resize(0, 0);
+        m_hwb.resize(0, 0);
+        m_hbb.resize(0, 0);
+    }
+    else if (m_hbb.size() == 0)
+    {
+        m_hww.resize(tsize * isize, tsize * isize);
+        m_hwb.resize(tsize * isize, tsize);
+        m_hbb.resize(tsize, tsize);
+    }
+}
+
 void accumulator_t::clear()
 {
     m_fx = 0.0;
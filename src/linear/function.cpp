@@ -16,6 +16,107 @@ auto tsize(const flatten_iterator_t& iterator)
 {
     return ::nano::size(iterator.dataset().target_dims());
 }
+
+void cumulate_gw(tensor2d_t& gw, const tensor2d_cmap_t& gmatrix, const tensor2d_cmap_t& inputs)
+{
+    gw.matrix() += gmatrix.matrix().transpose() * inputs.matrix();
+}
+
+void cumulate_gw(tensor2d_t& gw, const tensor2d_cmap_t& gmatrix, const flatten32_cmap_t& inputs)
+{
+    // NB: the matrix product is computed in single precision, but the results are cumulated in double precision
+    gw.matrix() += (gmatrix.matrix().cast<float>().transpose() * inputs.matrix()).cast<scalar_t>();
+}
+
+void cumulate_gw(tensor2d_t& gw, const tensor2d_cmap_t& gmatrix, const sparse_flatten_t& inputs)
+{
+    const auto defaults = inputs.m_defaults.vector();
+    const auto dcolumns = inputs.m_dense_columns.vector();
+    const auto scolumns = inputs.m_sparse_columns.vector();
+
+    auto gwmatrix = gw.matrix();
+    gwmatrix(Eigen::all, dcolumns) += gmatrix.matrix().transpose() * inputs.m_dense.matrix();
+
+    // NB: the default values of the sparse columns are shared by all samples
+    const eigen_vector_t<scalar_t> gsum = gmatrix.matrix().colwise().sum().transpose();
+    gwmatrix(Eigen::all, scolumns) += gsum * defaults.transpose();
+
+    for (tensor_size_t sample = 0, samples = inputs.samples(); sample < samples; ++sample)
+    {
+        for (auto k = inputs.m_offsets(sample); k < inputs.m_offsets(sample + 1); ++k)
+        {
+            const auto column = inputs.m_columns(k);
+            const auto delta  = inputs.m_values(k) - defaults(column);
+            gwmatrix.col(scolumns(column)) += delta * gmatrix.matrix().row(sample).transpose();
+        }
+    }
+}
+
+///
+/// \brief cumulates partial results per thread when evaluating the linear function at multiple points at once.
+///
+struct batch_accumulator_t
+{
+    batch_accumulator_t() = default;
+
+    batch_accumulator_t(const tensor_size_t points, const tensor_size_t isize, const tensor_size_t tsize)
+        : m_fx(points)
+        , m_gb(points * tsize)
+        , m_gw(points * tsize, isize)
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        m_fx.zero();
+        m_gb.zero();
+        m_gw.zero();
+    }
+
+    batch_accumulator_t& operator+=(const batch_accumulator_t& other)
+    {
+        m_fx += other.m_fx;
+        m_gb += other.m_gb;
+        m_gw += other.m_gw;
+        return *this;
+    }
+
+    batch_accumulator_t& operator/=(const tensor_size_t samples)
+    {
+        m_fx /= static_cast<scalar_t>(samples);
+        m_gb /= static_cast<scalar_t>(samples);
+        m_gw /= static_cast<scalar_t>(samples);
+        return *this;
+    }
+
+    // attributes
+    tensor4d_t m_outputs;  ///< predictions for all points (samples, points * tsize)
+    tensor4d_t m_koutputs; ///< predictions for a given point (samples, target dimensions...)
+    tensor1d_t m_loss_fx;  ///< loss values for a given point
+    tensor4d_t m_loss_gx;  ///< loss gradients wrt outputs for a given point
+    tensor2d_t m_gmatrix;  ///< loss gradients wrt outputs for all points (samples, points * tsize)
+    tensor1d_t m_fx;       ///< sum of loss values for all points
+    tensor1d_t m_gb;       ///< sum of loss gradients wrt bias for all points
+    tensor2d_t m_gw;       ///< sum of loss gradients wrt weights for all points
+};
+
+auto input(const tensor2d_cmap_t& inputs, const tensor_size_t sample)
+{
+    return inputs.vector(sample);
+}
+
+auto input(const flatten32_cmap_t& inputs, const tensor_size_t sample)
+{
+    return eigen_vector_t<scalar_t>{inputs.vector(sample).cast<scalar_t>()};
+}
+
+auto input(const sparse_flatten_t& inputs, const tensor_size_t sample)
+{
+    eigen_vector_t<scalar_t> values(inputs.columns());
+    inputs.densify(sample, map_tensor(values.data(), values.size()));
+    return values;
+}
 } // namespace
 
 linear::function_t::function_t(const flatten_iterator_t& iterator, const loss_t& loss, scalar_t l1reg, scalar_t l2reg)
@@ -33,6 +134,7 @@ linear::function_t::function_t(const flatten_iterator_t& iterator, const loss_t&
 
     convex(m_loss.convex() ? convexity::yes : convexity::no);
     smooth((m_loss.smooth() && m_l1reg <= 0.0) ? smoothness::yes : smoothness::no);
+    reentrant(false);
     strong_convexity(m_l2reg / static_cast<scalar_t>(m_isize * m_tsize));
 }
 
@@ -48,78 +150,101 @@ scalar_t linear::function_t::do_eval(eval_t eval) const
     const auto wsize = w.size();
     const auto bsize = b.size();
 
-    std::for_each(m_accumulators.begin(), m_accumulators.end(), [&](auto& accumulator) { accumulator.clear(); });
+    const auto has_hess = eval.has_hess();
+    std::for_each(m_accumulators.begin(), m_accumulators.end(),
+                  [&](auto& accumulator)
+                  {
+                      accumulator.hessian(has_hess);
+                      accumulator.clear();
+                  });
 
-    m_iterator.loop(
-        [&](tensor_range_t range, size_t tnum, tensor2d_cmap_t inputs, tensor4d_cmap_t targets)
-        {
-            assert(tnum < m_accumulators.size());
-            auto& accumulator = m_accumulators[tnum];
+    const auto cumulate = [&](tensor_range_t range, size_t tnum, const auto& inputs, const auto& weights,
+                              tensor4d_cmap_t targets)
+    {
+        assert(tnum < m_accumulators.size());
+        auto& accumulator = m_accumulators[tnum];
 
-            ::nano::linear::predict(inputs, w, b, accumulator.m_outputs);
-            m_loss.value(targets, accumulator.m_outputs, accumulator.m_loss_fx);
+        ::nano::linear::predict(inputs, weights, b, accumulator.m_outputs);
+        m_loss.eval(targets, accumulator.m_outputs, accumulator.m_loss_fx,
+                    eval.has_grad() ? &accumulator.m_loss_gx : nullptr,
+                    eval.has_hess() ? &accumulator.m_loss_hx : nullptr);
 
-            accumulator.m_fx += accumulator.m_loss_fx.sum();
+        accumulator.m_fx += accumulator.m_loss_fx.sum();
 
-            if (eval.has_grad())
-            {
-                m_loss.vgrad(targets, accumulator.m_outputs, accumulator.m_loss_gx);
+        if (eval.has_grad())
+        {
+            const auto gmatrix = accumulator.m_loss_gx.reshape(range.size(), m_tsize);
+            accumulator.m_gb += gmatrix.matrix().colwise().sum().transpose();
+            ::cumulate_gw(accumulator.m_gw, gmatrix, inputs);
+        }
 
-                const auto gmatrix = accumulator.m_loss_gx.reshape(range.size(), m_tsize);
-                accumulator.m_gb += gmatrix.matrix().colwise().sum().transpose();
-                accumulator.m_gw += gmatrix.matrix().transpose() * inputs;
-            }
+        if (eval.has_hess())
+        {
+            // TODO: write it using more efficient linear algebra operations
+            const auto& htensor = accumulator.m_loss_hx;
 
-            if (eval.has_hess())
+            for (tensor_size_t k = 0; k < range.size(); ++k)
             {
-                m_loss.vhess(targets, accumulator.m_outputs, accumulator.m_loss_hx);
+                const auto kinput   = ::input(inputs, k);
+                const auto khmatrix = htensor.tensor(k).reshape(m_tsize, m_tsize).matrix();
+                // const auto khvector = htensor.tensor(k).reshape(m_tsize, m_tsize).vector();
 
-                // TODO: write it using more efficient linear algebra operations
-                const auto& htensor = accumulator.m_loss_hx;
-
-                for (tensor_size_t k = 0; k < range.size(); ++k)
+                for (tensor_size_t t1 = 0; t1 < m_tsize; ++t1)
                 {
-                    const auto kinput   = inputs.vector(k);
-                    const auto khmatrix = htensor.tensor(k).reshape(m_tsize, m_tsize).matrix();
-                    // const auto khvector = htensor.tensor(k).reshape(m_tsize, m_tsize).vector();
-
-                    for (tensor_size_t t1 = 0; t1 < m_tsize; ++t1)
+                    for (tensor_size_t t2 = 0; t2 < m_tsize; ++t2)
                     {
-                        for (tensor_size_t t2 = 0; t2 < m_tsize; ++t2)
-                        {
-                            accumulator.m_hww.matrix().block(t1 * m_isize, t2 * m_isize, m_isize, m_isize) +=
-                                khmatrix(t1, t2) * (kinput * kinput.transpose());
-
-                            /*for (tensor_size_t i1 = 0; i1 < m_isize; ++i1)
-                            {
-                                for (tensor_size_t i2 = 0; i2 < m_isize; ++i2)
-                                {
-                                    accumulator.m_hx(t1 * m_isize + i1, t2 * m_isize + i2) +=
-                                        khmatrix(t1, t2) * kinput(i1) * kinput(i2);
-                                }
-                            }*/
-                        }
-                    }
-
-                    for (tensor_size_t t1 = 0; t1 < m_tsize; ++t1)
-                    {
-                        accumulator.m_hwb.reshape(m_tsize, m_isize, m_tsize).matrix(t1).noalias() +=
-                            kinput * khmatrix.row(t1);
+                        accumulator.m_hww.matrix().block(t1 * m_isize, t2 * m_isize, m_isize, m_isize) +=
+                            khmatrix(t1, t2) * (kinput * kinput.transpose());
 
                         /*for (tensor_size_t i1 = 0; i1 < m_isize; ++i1)
                         {
-                            for (tensor_size_t t2 = 0; t2 < m_tsize; ++t2)
+                            for (tensor_size_t i2 = 0; i2 < m_isize; ++i2)
                             {
-                                accumulator.m_hwb(t1 * m_isize + i1, t2) +=
-                                    khmatrix(t1, t2) * kinput(i1);
+                                accumulator.m_hx(t1 * m_isize + i1, t2 * m_isize + i2) +=
+                                    khmatrix(t1, t2) * kinput(i1) * kinput(i2);
                             }
                         }*/
                     }
+                }
 
-                    accumulator.m_hbb += khmatrix;
+                for (tensor_size_t t1 = 0; t1 < m_tsize; ++t1)
+                {
+                    accumulator.m_hwb.reshape(m_tsize, m_isize, m_tsize).matrix(t1).noalias() +=
+                        kinput * khmatrix.row(t1);
+
+                    /*for (tensor_size_t i1 = 0; i1 < m_isize; ++i1)
+                    {
+                        for (tensor_size_t t2 = 0; t2 < m_tsize; ++t2)
+                        {
+                            accumulator.m_hwb(t1 * m_isize + i1, t2) +=
+                                khmatrix(t1, t2) * kinput(i1);
+                        }
+                    }*/
                 }
+
+                accumulator.m_hbb += khmatrix;
             }
-        });
+        }
+    };
+
+    if (m_iterator.sparse())
+    {
+        m_iterator.loop([&](tensor_range_t range, size_t tnum, const sparse_flatten_t& inputs, tensor4d_cmap_t targets)
+                        { cumulate(range, tnum, inputs, w, targets); });
+    }
+    else if (m_iterator.precision() == precision_type::float32)
+    {
+        m_weights32.resize(w.dims());
+        m_weights32.matrix() = w.matrix().cast<float>();
+
+        m_iterator.loop([&](tensor_range_t range, size_t tnum, flatten32_cmap_t inputs, tensor4d_cmap_t targets)
+                        { cumulate(range, tnum, inputs, m_weights32.tensor(), targets); });
+    }
+    else
+    {
+        m_iterator.loop([&](tensor_range_t range, size_t tnum, tensor2d_cmap_t inputs, tensor4d_cmap_t targets)
+                        { cumulate(range, tnum, inputs, w, targets); });
+    }
 
     const auto& accumulator = ::nano::sum_reduce(m_accumulators, m_iterator.samples().size());
 
@@ -166,3 +291,199 @@ scalar_t linear::function_t::do_eval(eval_t eval) const
     }
     return fx;
 }
+
+void linear::function_t::do_hessian_vector(vector_cmap_t x, vector_cmap_t v, vector_map_t Hv) const
+{
+    const auto b  = bias(x);
+    const auto w  = weights(x);
+    const auto vb = bias(v);
+    const auto vw = weights(v);
+
+    std::for_each(m_accumulators.begin(), m_accumulators.end(),
+                  [&](auto& accumulator)
+                  {
+                      accumulator.hessian(false);
+                      accumulator.clear();
+                  });
+
+    // NB: the Hessian-vector product is computed without forming the Hessian:
+    //  Hv = sum_k J_k^T * H_k * (J_k * v), where
+    //      J_k * v is the variation of the outputs of the k-th sample along v (a prediction with the weights v) and
+    //      H_k is the Hessian of the loss wrt the outputs of the k-th sample.
+    const auto cumulate = [&](tensor_range_t range, size_t tnum, const auto& inputs, const auto& weights,
+                              const auto& vweights, tensor4d_cmap_t targets)
+    {
+        assert(tnum < m_accumulators.size());
+        auto& accumulator = m_accumulators[tnum];
+
+        ::nano::linear::predict(inputs, weights, b, accumulator.m_outputs);
+        m_loss.eval(targets, accumulator.m_outputs, accumulator.m_loss_fx, nullptr, &accumulator.m_loss_hx);
+
+        ::nano::linear::predict(inputs, vweights, vb, accumulator.m_outputs);
+
+        const auto omatrix = accumulator.m_outputs.reshape(range.size(), m_tsize);
+        accumulator.m_loss_gx.resize(accumulator.m_outputs.dims());
+
+        auto qmatrix = accumulator.m_loss_gx.reshape(range.size(), m_tsize);
+        for (tensor_size_t k = 0; k < range.size(); ++k)
+        {
+            const auto khmatrix = accumulator.m_loss_hx.tensor(k).reshape(m_tsize, m_tsize).matrix();
+            qmatrix.vector(k)   = khmatrix * omatrix.vector(k);
+        }
+
+        accumulator.m_gb += qmatrix.matrix().colwise().sum().transpose();
+        ::cumulate_gw(accumulator.m_gw, qmatrix, inputs);
+    };
+
+    if (m_iterator.sparse())
+    {
+        m_iterator.loop([&](tensor_range_t range, size_t tnum, const sparse_flatten_t& inputs, tensor4d_cmap_t targets)
+                        { cumulate(range, tnum, inputs, w, vw, targets); });
+    }
+    else if (m_iterator.precision() == precision_type::float32)
+    {
+        m_weights32.resize(w.dims());
+        m_weights32.matrix() = w.matrix().cast<float>();
+
+        m_vweights32.resize(vw.dims());
+        m_vweights32.matrix() = vw.matrix().cast<float>();
+
+        m_iterator.loop(
+            [&](tensor_range_t range, size_t tnum, flatten32_cmap_t inputs, tensor4d_cmap_t targets)
+            { cumulate(range, tnum, inputs, m_weights32.tensor(), m_vweights32.tensor(), targets); });
+    }
+    else
+    {
+        m_iterator.loop([&](tensor_range_t range, size_t tnum, tensor2d_cmap_t inputs, tensor4d_cmap_t targets)
+                        { cumulate(range, tnum, inputs, w, vw, targets); });
+    }
+
+    const auto& accumulator = ::nano::sum_reduce(m_accumulators, m_iterator.samples().size());
+
+    auto hb = bias(Hv);
+    auto hw = weights(Hv);
+
+    hb = accumulator.m_gb;
+    hw = accumulator.m_gw;
+
+    if (m_l2reg > 0.0)
+    {
+        hw.array() += m_l2reg * vw.array() / static_cast<scalar_t>(vw.size());
+    }
+}
+
+void linear::function_t::do_evaluate(matrix_cmap_t xs, vector_map_t fxs, matrix_map_t gxs) const
+{
+    const auto points   = xs.rows();
+    const auto has_grad = gxs.size() > 0;
+
+    // NB: stack the weights and the biases of all points, so that the predictions are computed
+    //  with a single matrix-matrix product per batch of samples (instead of one matrix-vector product per point).
+    auto ws = tensor2d_t{points * m_tsize, m_isize};
+    auto bs = tensor1d_t{points * m_tsize};
+    for (tensor_size_t k = 0; k < points; ++k)
+    {
+        const auto x = xs.tensor(k);
+
+        ws.matrix().middleRows(k * m_tsize, m_tsize) = weights(x).matrix();
+        bs.vector().segment(k * m_tsize, m_tsize)    = bias(x).vector();
+    }
+
+    auto accumulators = std::vector<batch_accumulator_t>(m_accumulators.size(), {points, m_isize, m_tsize});
+
+    const auto cumulate = [&](tensor_range_t range, size_t tnum, const auto& inputs, const auto& weights,
+                              tensor4d_cmap_t targets)
+    {
+        assert(tnum < accumulators.size());
+        auto& accumulator = accumulators[tnum];
+
+        const auto samples = range.size();
+
+        ::nano::linear::predict(inputs, weights, bs.tensor(), accumulator.m_outputs);
+
+        const auto omatrix = accumulator.m_outputs.reshape(samples, points * m_tsize).matrix();
+
+        accumulator.m_koutputs.resize(targets.dims());
+        accumulator.m_gmatrix.resize(samples, points * m_tsize);
+        for (tensor_size_t k = 0; k < points; ++k)
+        {
+            accumulator.m_koutputs.reshape(samples, m_tsize).matrix() = omatrix.middleCols(k * m_tsize, m_tsize);
+
+            m_loss.eval(targets, accumulator.m_koutputs, accumulator.m_loss_fx,
+                        has_grad ? &accumulator.m_loss_gx : nullptr, nullptr);
+
+            accumulator.m_fx(k) += accumulator.m_loss_fx.sum();
+
+            if (has_grad)
+            {
+                accumulator.m_gmatrix.matrix().middleCols(k * m_tsize, m_tsize) =
+                    accumulator.m_loss_gx.reshape(samples, m_tsize).matrix();
+            }
+        }
+
+        if (has_grad)
+        {
+            const auto gmatrix = accumulator.m_gmatrix.tensor();
+            accumulator.m_gb += gmatrix.matrix().colwise().sum().transpose();
+            ::cumulate_gw(accumulator.m_gw, gmatrix, inputs);
+        }
+    };
+
+    if (m_iterator.sparse())
+    {
+        m_iterator.loop([&](tensor_range_t range, size_t tnum, const sparse_flatten_t& inputs, tensor4d_cmap_t targets)
+                        { cumulate(range, tnum, inputs, ws.tensor(), targets); });
+    }
+    else if (m_iterator.precision() == precision_type::float32)
+    {
+        m_weights32.resize(ws.dims());
+        m_weights32.matrix() = ws.matrix().cast<float>();
+
+        m_iterator.loop([&](tensor_range_t range, size_t tnum, flatten32_cmap_t inputs, tensor4d_cmap_t targets)
+                        { cumulate(range, tnum, inputs, m_weights32.tensor(), targets); });
+    }
+    else
+    {
+        m_iterator.loop([&](tensor_range_t range, size_t tnum, tensor2d_cmap_t inputs, tensor4d_cmap_t targets)
+                        { cumulate(range, tnum, inputs, ws.tensor(), targets); });
+    }
+
+    const auto& accumulator = ::nano::sum_reduce(accumulators, m_iterator.samples().size());
+
+    // OK, normalize and add the regularization terms for each point
+    for (tensor_size_t k = 0; k < points; ++k)
+    {
+        const auto x = xs.tensor(k);
+        const auto w = weights(x);
+
+        if (has_grad)
+        {
+            auto gx = gxs.tensor(k);
+            auto gb = bias(gx);
+            auto gw = weights(gx);
+
+            gb.vector() = accumulator.m_gb.vector().segment(k * m_tsize, m_tsize);
+            gw.matrix() = accumulator.m_gw.matrix().middleRows(k * m_tsize, m_tsize);
+
+            if (m_l1reg > 0.0)
+            {
+                gw.array() += m_l1reg * w.array().sign() / static_cast<scalar_t>(w.size());
+            }
+            if (m_l2reg > 0.0)
+            {
+                gw.array() += m_l2reg * w.array() / static_cast<scalar_t>(w.size());
+            }
+        }
+
+        auto fx = accumulator.m_fx(k);
+        if (m_l1reg > 0.0)
+        {
+            fx += m_l1reg * w.array().abs().mean();
+        }
+        if (m_l2reg > 0.0)
+        {
+            fx += 0.5 * (std::sqrt(m_l2reg) * w.array()).square().mean();
+        }
+        fxs(k) = fx;
+    }
+}
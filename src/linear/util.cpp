@@ -27,6 +27,70 @@ void linear::predict(const tensor2d_cmap_t& inputs, const tensor2d_cmap_t& weigh
     predict(inputs, weights, bias, outputs.tensor());
 }
 
+void linear::predict(const tensor_cmap_t<float, 2>& inputs, const tensor_cmap_t<float, 2>& weights,
+                     const tensor1d_cmap_t& bias, tensor4d_map_t outputs)
+{
+    [[maybe_unused]] const auto isize   = weights.cols();
+    const auto                  tsize   = weights.rows();
+    const auto                  samples = inputs.size<0>();
+
+    assert(tsize == bias.size());
+    assert(samples == outputs.size<0>());
+    assert(samples * isize == inputs.size());
+    assert(samples * tsize == outputs.size());
+
+    outputs.reshape(samples, tsize).matrix() = (inputs.matrix() * weights.matrix().transpose()).cast<scalar_t>();
+    outputs.reshape(samples, tsize).matrix().rowwise() += bias.vector().transpose();
+}
+
+void linear::predict(const tensor_cmap_t<float, 2>& inputs, const tensor_cmap_t<float, 2>& weights,
+                     const tensor1d_cmap_t& bias, tensor4d_t& outputs)
+{
+    outputs.resize(inputs.size<0>(), bias.size(), 1, 1);
+    predict(inputs, weights, bias, outputs.tensor());
+}
+
+void linear::predict(const sparse_flatten_t& inputs, const tensor2d_cmap_t& weights, const tensor1d_cmap_t& bias,
+                     tensor4d_map_t outputs)
+{
+    const auto tsize   = weights.rows();
+    const auto samples = inputs.samples();
+
+    assert(tsize == bias.size());
+    assert(weights.cols() == inputs.columns());
+    assert(samples == outputs.size<0>());
+    assert(samples * tsize == outputs.size());
+
+    const auto wmatrix  = weights.matrix();
+    const auto defaults = inputs.m_defaults.vector();
+    const auto dcolumns = inputs.m_dense_columns.vector();
+    const auto scolumns = inputs.m_sparse_columns.vector();
+
+    // NB: the default values of the sparse columns are shared by all samples, so they are cumulated with the bias
+    const eigen_vector_t<scalar_t> offset = bias.vector() + wmatrix(Eigen::all, scolumns) * defaults;
+
+    auto omatrix = outputs.reshape(samples, tsize).matrix();
+    omatrix      = inputs.m_dense.matrix() * wmatrix(Eigen::all, dcolumns).transpose();
+    omatrix.rowwise() += offset.transpose();
+
+    for (tensor_size_t sample = 0; sample < samples; ++sample)
+    {
+        for (auto k = inputs.m_offsets(sample); k < inputs.m_offsets(sample + 1); ++k)
+        {
+            const auto column = inputs.m_columns(k);
+            const auto delta  = inputs.m_values(k) - defaults(column);
+            omatrix.row(sample) += delta * wmatrix.col(scolumns(column)).transpose();
+        }
+    }
+}
+
+void linear::predict(const sparse_flatten_t& inputs, const tensor2d_cmap_t& weights, const tensor1d_cmap_t& bias,
+                     tensor4d_t& outputs)
+{
+    outputs.resize(inputs.samples(), bias.size(), 1, 1);
+    predict(inputs, weights, bias, outputs.tensor());
+}
+
 tensor2d_t linear::evaluate(const dataset_t& dataset, const indices_t& samples, const loss_t& loss,
                             const tensor2d_t& weights, const tensor1d_t& bias, const tensor_size_t batch)
 {
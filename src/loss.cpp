@@ -102,6 +102,60 @@ void loss_t::vhess(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor7d_t&
     vhess(targets, outputs, vhesss.tensor());
 }
 
+void loss_t::eval(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor1d_map_t values, tensor4d_map_t vgrads,
+                  tensor7d_map_t vhesss) const
+{
+    check_compatible("outputs", outputs.dims(), "targets", targets.dims());
+    if (values.size() > 0)
+    {
+        check_compatible("value buffer", values.dims(), "samples", make_dims(targets.size<0>()));
+    }
+    if (vgrads.size() > 0)
+    {
+        check_compatible("gradient buffer", vgrads.dims(), "targets", targets.dims());
+    }
+    if (vhesss.size() > 0)
+    {
+        check_compatible("hessian buffer", vhesss.dims(), "cross-targets", make_hess_dims(targets.dims()));
+    }
+
+    do_eval(targets, outputs, values, vgrads, vhesss);
+}
+
+void loss_t::eval(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor1d_t& values, tensor4d_t* vgrads,
+                  tensor7d_t* vhesss) const
+{
+    values.resize(targets.size<0>());
+    if (vgrads != nullptr)
+    {
+        vgrads->resize(targets.dims());
+    }
+    if (vhesss != nullptr)
+    {
+        vhesss->resize(make_hess_dims(targets));
+    }
+
+    eval(targets, outputs, values.tensor(), (vgrads != nullptr) ? vgrads->tensor() : tensor4d_map_t{},
+         (vhesss != nullptr) ? vhesss->tensor() : tensor7d_map_t{});
+}
+
+void loss_t::do_eval(tensor4d_cmap_t targets, tensor4d_cmap_t outputs, tensor1d_map_t values, tensor4d_map_t vgrads,
+                     tensor7d_map_t vhesss) const
+{
+    if (values.size() > 0)
+    {
+        do_value(targets, outputs, values);
+    }
+    if (vgrads.size() > 0)
+    {
+        do_vgrad(targets, outputs, vgrads);
+    }
+    if (vhesss.size() > 0)
+    {
+        do_vhess(targets, outputs, vhesss);
+    }
+}
+
 factory_t<loss_t>& loss_t::all()
 {
     static auto manager = factory_t<loss_t>{};
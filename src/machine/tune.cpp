@@ -6,12 +6,11 @@
 using namespace nano::ml;
 
 result_t nano::ml::tune(const string_t& prefix, const indices_t& samples, const params_t& fit_params,
-                        param_spaces_t param_spaces, const tune_callback_t& callback)
+                        param_spaces_t param_spaces, const tune_callback_t& callback, parallel::scheduler_t& tpool)
 {
     const auto splits = fit_params.splitter().split(samples);
     const auto folds  = static_cast<tensor_size_t>(splits.size());
 
-    auto tpool  = parallel::pool_t{};
     auto result = result_t{std::move(param_spaces), folds};
 
     // tune hyper-parameters (if any) in parallel by hyper-parameter trials and folds
@@ -1,3 +1,4 @@
+#include <Eigen/Dense>
 #include <nano/critical.h>
 #include <nano/function/cuts.h>
 #include <solver/bundle/bundle.h>
@@ -90,6 +91,11 @@ const bundle_t::solution_t& bundle_t::solve(const scalar_t tau, const scalar_t l
 {
     const auto n = dims();
 
+    if (!std::isfinite(level) && do_solve_dual(nullptr, tau))
+    {
+        return m_solution;
+    }
+
     // construct quadratic programming problem
     // NB: equivalent and simpler problem is to solve for `y = x - x_k^`!
     m_program.Q().block(0, 0, n, n) = matrix_t::identity(n, n) / tau;
@@ -103,6 +109,11 @@ const bundle_t::solution_t& bundle_t::solve(const matrix_t& M, const scalar_t ta
 {
     const auto n = dims();
 
+    if (!std::isfinite(level) && do_solve_dual(&M, tau))
+    {
+        return m_solution;
+    }
+
     // construct quadratic programming problem
     // NB: equivalent and simpler problem is to solve for `y = x - x_k^`!
     m_program.Q().block(0, 0, n, n) = M / tau;
@@ -165,6 +176,83 @@ const bundle_t::solution_t& bundle_t::do_solve(const scalar_t tau, const scalar_
     return m_solution;
 }
 
+bool bundle_t::do_solve_dual(const matrix_t* M, const scalar_t tau)
+{
+    assert(size() > 0);
+    assert(dims() == m_x.size());
+
+    // NB: the dual of the quadratic program without the level constraint is (see (2), ch. 10):
+    //  argmin_a tau/2 * |sum_j a_j * g_j|^2_(M^-1) - sum_j a_j * h_j s.t. a_j >= 0 and sum_j a_j = 1,
+    //
+    //  with the primal solution: x = x_k^ - tau * M^-1 * sum_j a_j * g_j and r = max_j (h_j + <g_j, x - x_k^>).
+    const auto n = dims();
+    const auto m = size();
+
+    const auto G = m_bundleG.matrix().topLeftCorner(m, n);
+
+    m_dualQ.resize(n, m);
+    if (M == nullptr)
+    {
+        m_dualQ.matrix() = G.transpose();
+    }
+    else
+    {
+        const auto llt = M->matrix().llt();
+        if (llt.info() != Eigen::Success)
+        {
+            return false;
+        }
+        m_dualQ.matrix() = llt.solve(G.transpose());
+    }
+
+    m_dualH.resize(m, m);
+    m_dualH.matrix().noalias() = tau * G * m_dualQ.matrix();
+
+    m_dualq.resize(m);
+    m_dualq.vector() = -m_bundleH.vector().segment(0, m);
+
+    // warm-start from the previous Lagrange multipliers (if any)
+    m_duala.resize(m);
+    m_duala.zero();
+    if (const auto k = std::min(m, m_solution.m_alphas.size()); k > 0)
+    {
+        m_duala.vector().head(k) = m_solution.m_alphas.vector().head(k);
+    }
+
+    if (!m_dual.solve(m_dualH.tensor(), m_dualq.tensor(), m_duala.tensor()))
+    {
+        return false;
+    }
+
+    auto y = vector_t{n};
+    y.vector().noalias() = -tau * m_dualQ.matrix() * m_duala.vector();
+    if (!y.all_finite())
+    {
+        return false;
+    }
+
+    // NB: the duality gap is sum_j a_j * (r - h_j - <g_j, x - x_k^>) and it should be zero at the optimum,
+    //  but it may not be for badly conditioned problems (e.g. with sub-gradients of very different magnitudes).
+    auto& cuts    = m_dualq;
+    cuts.vector() = m_bundleH.vector().segment(0, m) + G * y.vector();
+
+    const auto r   = cuts.max();
+    const auto gap = r - cuts.vector().dot(m_duala.vector());
+    if (!std::isfinite(gap) || gap > epsilon2<scalar_t>() * (1.0 + std::fabs(r)))
+    {
+        return false;
+    }
+
+    m_solution.m_x      = y + m_x;
+    m_solution.m_r      = r;
+    m_solution.m_tau    = tau;
+    m_solution.m_alphas = m_duala;
+    m_solution.m_lambda = 0.0;
+    m_solution.m_status = solver_status::kkt_optimality_test;
+
+    return true;
+}
+
 scalar_t bundle_t::fhat(const vector_t& x) const
 {
     assert(size() > 0);
@@ -3,6 +3,7 @@
 #include <nano/function/quadratic.h>
 #include <nano/solver.h>
 #include <nano/tensor/algorithm.h>
+#include <solver/bundle/simplex.h>
 
 namespace nano
 {
@@ -20,6 +21,10 @@ namespace nano
 ///     then this formulation becames the penalized proximal bundle algorithms
 ///     (see 2, RQB from 3, mRQB from 4, FPBA1/FPBA2 from 5).
 ///
+/// NB: the quadratic program is solved without the level constraint by a dedicated active-set method
+///     on the (small) dual problem warm-started from the previous Lagrange multipliers (see simplex_qp_t),
+///     with a fallback to the generic interior-point solver (e.g. for the level constraint or if not converged).
+///
 /// NB: the bundle is kept small by:
 ///     - first removing all inactive constraints and
 ///     - then the ones with the smallest Lagrange multipliers if needed - see (1, ch 5.1.4).
@@ -146,6 +151,7 @@ private:
     void append(vector_cmap_t y, vector_cmap_t gy, scalar_t fy, bool serious_step);
 
     const solution_t& do_solve(scalar_t tau, scalar_t level, const logger_t&);
+    bool              do_solve_dual(const matrix_t* M, scalar_t tau);
 
     // attributes
     quadratic_program_t m_program;  ///< quadratic program
@@ -158,5 +164,10 @@ private:
     vector_t            m_gx;       ///< function gradient at the proximal center (dims)
     scalar_t            m_fx;       ///< function value at the proximal center
     vector_t            m_wlevel;   ///< left-side inequality constraint for the level
+    simplex_qp_t        m_dual;     ///< solver for the dual quadratic program (without the level constraint)
+    matrix_t            m_dualQ;    ///< buffer: M^-1 * G^T of shape (dims, size)
+    matrix_t            m_dualH;    ///< buffer: the Hessian of the dual quadratic program of shape (size, size)
+    vector_t            m_dualq;    ///< buffer: the linear term of the dual quadratic program of shape (size,)
+    vector_t            m_duala;    ///< buffer: the solution of the dual quadratic program of shape (size,)
 };
 } // namespace nano
@@ -0,0 +1,254 @@
+#include <Eigen/Dense>
+#include <nano/core/numeric.h>
+#include <solver/bundle/simplex.h>
+
+using namespace nano;
+
+bool simplex_qp_t::solve(matrix_cmap_t H, vector_cmap_t q, vector_map_t alphas)
+{
+    const auto m = q.size();
+
+    assert(m > 0);
+    assert(H.rows() == m);
+    assert(H.cols() == m);
+    assert(alphas.size() == m);
+
+    m_iterations = 0;
+    m_shift      = 1.0 + H.matrix().diagonal().array().abs().maxCoeff();
+    m_delta      = epsilon0<scalar_t>() * m_shift;
+
+    m_L.resize(m, m);
+    m_z.resize(m);
+    m_hq.resize(m);
+    m_h1.resize(m);
+
+    // feasible starting point: warm-start if possible, otherwise the best vertex of the simplex
+    alphas.array() = alphas.array().max(0.0);
+    if (const auto sum = alphas.sum(); std::isfinite(sum) && sum > 0.0)
+    {
+        alphas.array() /= sum;
+    }
+    else
+    {
+        alphas.zero();
+    }
+
+    m_active.clear();
+    for (tensor_size_t i = 0; i < m; ++i)
+    {
+        if (alphas(i) > 0.0)
+        {
+            m_active.push_back(i);
+        }
+    }
+
+    if (m_active.empty() || !factorize(H))
+    {
+        tensor_size_t index = 0;
+        (0.5 * H.matrix().diagonal().array() + q.array()).minCoeff(&index);
+
+        alphas.zero();
+        alphas(index) = 1.0;
+
+        m_active.assign(1U, index);
+        if (!factorize(H))
+        {
+            return false;
+        }
+    }
+
+    auto added = false;
+    for (const auto max_iterations = 10 * (m + 1); m_iterations < max_iterations; ++m_iterations)
+    {
+        // minimize on the positive variables (with the equality constraint)
+        minimize(q);
+
+        const auto k = static_cast<tensor_size_t>(m_active.size());
+        if (!m_z.slice(0, k).all_finite())
+        {
+            return false;
+        }
+
+        // NB: the last added variable should become positive, otherwise the multiplier was negative
+        //  only because of round-off errors and the current point is optimal (up to numerical precision).
+        if (added && m_z(k - 1) <= 0.0)
+        {
+            return true;
+        }
+
+        // blocking variables: move towards the minimizer as long as feasible and then remove them
+        auto step    = 1.0;
+        auto blocked = false;
+        for (tensor_size_t i = 0; i < k; ++i)
+        {
+            const auto alpha = alphas(m_active[static_cast<size_t>(i)]);
+            if (const auto z = m_z(i); z <= 0.0)
+            {
+                step    = std::min(step, alpha > z ? alpha / (alpha - z) : 0.0);
+                blocked = true;
+            }
+        }
+
+        for (tensor_size_t i = 0; i < k; ++i)
+        {
+            auto& alpha = alphas(m_active[static_cast<size_t>(i)]);
+            alpha += step * (m_z(i) - alpha);
+        }
+
+        added = false;
+        if (blocked)
+        {
+            if (!remove(H, alphas))
+            {
+                return false;
+            }
+            continue;
+        }
+
+        // optimality test: the multipliers of the zero variables should be non-negative
+        tensor_size_t index  = -1;
+        scalar_t      lambda = 0.0;
+        for (tensor_size_t i = 0; i < m; ++i)
+        {
+            const auto gi = H.vector(i).dot(alphas.vector()) + m_delta * alphas(i) + q(i);
+            if (alphas(i) <= 0.0 && gi - m_mu < lambda)
+            {
+                index  = i;
+                lambda = gi - m_mu;
+            }
+        }
+
+        if (index < 0 || lambda >= -epsilon1<scalar_t>() * (1.0 + std::fabs(m_mu)))
+        {
+            return true;
+        }
+
+        // add the variable with the most negative multiplier
+        added = true;
+        m_active.push_back(index);
+        if (!factorize(H, k) && !exchange(H, alphas))
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+bool simplex_qp_t::factorize(matrix_cmap_t H)
+{
+    for (tensor_size_t k = 0, size = static_cast<tensor_size_t>(m_active.size()); k < size; ++k)
+    {
+        if (!factorize(H, k))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool simplex_qp_t::factorize(matrix_cmap_t H, const tensor_size_t k)
+{
+    // NB: append a row to the Cholesky factor: [L 0; l^T d], where L * l = H_(active, index)
+    const auto index = m_active[static_cast<size_t>(k)];
+
+    auto row = m_L.matrix().row(k).head(k);
+    for (tensor_size_t j = 0; j < k; ++j)
+    {
+        row(j) = H(index, m_active[static_cast<size_t>(j)]) + m_shift;
+    }
+    m_L.matrix().topLeftCorner(k, k).triangularView<Eigen::Lower>().solveInPlace(row.transpose());
+
+    // NB: the variable is (numerically) linearly dependent on the previous ones if d ~ 0
+    const auto d2 = H(index, index) + m_shift + m_delta - row.squaredNorm();
+    if (!std::isfinite(d2) || d2 <= epsilon1<scalar_t>() * m_shift)
+    {
+        return false;
+    }
+
+    m_L(k, k) = std::sqrt(d2);
+    return true;
+}
+
+bool simplex_qp_t::exchange(matrix_cmap_t H, vector_map_t alphas)
+{
+    // NB: the last variable is linearly dependent on the positive ones, so the objective is linear along the direction
+    //  p = [-H_a^-1 * H_(active, index); 1] and decreases as the multiplier of the new variable is negative.
+    //  => move along this direction until a positive variable becomes zero and remove it, see (2).
+    const auto k     = static_cast<tensor_size_t>(m_active.size()) - 1;
+    const auto index = m_active[static_cast<size_t>(k)];
+
+    auto p = m_z.vector().head(k);
+    p      = m_L.matrix().row(k).head(k).transpose();
+    m_L.matrix().topLeftCorner(k, k).transpose().triangularView<Eigen::Upper>().solveInPlace(p);
+
+    auto step = std::numeric_limits<scalar_t>::infinity();
+    for (tensor_size_t i = 0; i < k; ++i)
+    {
+        if (p(i) > 0.0)
+        {
+            step = std::min(step, alphas(m_active[static_cast<size_t>(i)]) / p(i));
+        }
+    }
+
+    if (!std::isfinite(step))
+    {
+        // NB: not a direction of zero curvature because of round-off errors, so keep the variable with regularization
+        m_L(k, k) = std::sqrt(epsilon1<scalar_t>() * m_shift);
+        return true;
+    }
+
+    for (tensor_size_t i = 0; i < k; ++i)
+    {
+        alphas(m_active[static_cast<size_t>(i)]) -= step * p(i);
+    }
+    alphas(index) = step;
+
+    return remove(H, alphas);
+}
+
+bool simplex_qp_t::remove(matrix_cmap_t H, vector_map_t alphas)
+{
+    const auto op = [&](const tensor_size_t index) { return alphas(index) <= epsilon0<scalar_t>(); };
+    for (const auto index : m_active)
+    {
+        if (op(index))
+        {
+            alphas(index) = 0.0;
+        }
+    }
+    m_active.erase(std::remove_if(m_active.begin(), m_active.end(), op), m_active.end());
+
+    alphas.array() /= alphas.sum();
+
+    return !m_active.empty() && factorize(H);
+}
+
+void simplex_qp_t::minimize(vector_cmap_t q)
+{
+    // NB: solve the KKT system: H_a * z + q_a = mu * 1 and sum(z) = 1
+    //  => z = mu * H_a^-1 * 1 - H_a^-1 * q_a and mu = (1 + 1.dot(H_a^-1 * q_a)) / 1.dot(H_a^-1 * 1),
+    //
+    //  where the shifted matrix H_a + shift * 1 * 1^T is used instead as it gives the same minimizer on the simplex
+    //  with the multiplier mu + shift, but it is much better conditioned when H_a is (close to) singular.
+    const auto k = static_cast<tensor_size_t>(m_active.size());
+
+    auto hq = m_hq.vector().head(k);
+    auto h1 = m_h1.vector().head(k);
+    for (tensor_size_t i = 0; i < k; ++i)
+    {
+        hq(i) = q(m_active[static_cast<size_t>(i)]);
+        h1(i) = 1.0;
+    }
+
+    const auto L = m_L.matrix().topLeftCorner(k, k).triangularView<Eigen::Lower>();
+    L.solveInPlace(hq);
+    L.transpose().solveInPlace(hq);
+    L.solveInPlace(h1);
+    L.transpose().solveInPlace(h1);
+
+    const auto mu = (1.0 + hq.sum()) / h1.sum();
+
+    m_mu                 = mu - m_shift;
+    m_z.vector().head(k) = mu * h1 - hq;
+}
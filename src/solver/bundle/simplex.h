@@ -0,0 +1,64 @@
+#pragma once
+
+#include <nano/tensor.h>
+
+namespace nano
+{
+///
+/// \brief active-set solver for small dense convex quadratic programs on the unit simplex:
+///     argmin_a 1/2 * a.dot(H * a) + q.dot(a)
+///         s.t. a >= 0 and sum(a) = 1,
+///
+/// like the dual of the proximal bundle problem without the level constraint (see bundle_t).
+///
+/// see (1) "Numerical optimization", by J. Nocedal, S. Wright, 2006 - ch. 16.5 (active-set methods)
+/// see (2) "A dual method for certain positive semidefinite quadratic programming problems", by K. Kiwiel, 1989
+///
+/// NB: the solver is warm-started from the given point (e.g. the solution of the previous bundle iteration),
+///     as typically the bundle changes by only one or two linearizations between two iterations.
+///
+/// NB: the Cholesky factorization of the sub-matrix of the positive variables is updated incrementally
+///     when adding a variable (the most frequent case) and it is recomputed only when removing variables.
+///
+/// NB: the matrix H is positive semi-definite (e.g. a Gram matrix of sub-gradients), so the positive variables
+///     are kept linearly independent by exchanging them along directions of zero curvature like in (2).
+///
+class NANO_PUBLIC simplex_qp_t
+{
+public:
+    ///
+    /// \brief constructor
+    ///
+    simplex_qp_t() = default;
+
+    ///
+    /// \brief solve the quadratic program starting from the given point (if feasible).
+    ///
+    /// returns true if the KKT optimality conditions are satisfied (up to numerical precision).
+    ///
+    bool solve(matrix_cmap_t H, vector_cmap_t q, vector_map_t alphas);
+
+    ///
+    /// \brief returns the number of iterations of the last call.
+    ///
+    tensor_size_t iterations() const { return m_iterations; }
+
+private:
+    bool factorize(matrix_cmap_t H);
+    bool factorize(matrix_cmap_t H, tensor_size_t k);
+    bool exchange(matrix_cmap_t H, vector_map_t alphas);
+    bool remove(matrix_cmap_t H, vector_map_t alphas);
+    void minimize(vector_cmap_t q);
+
+    // attributes
+    scalar_t                   m_shift{0.0};    ///< constant added to all elements of H
+    scalar_t                   m_delta{0.0};    ///< regularization of the diagonal of H
+    std::vector<tensor_size_t> m_active;        ///< indices of the positive variables
+    matrix_t                   m_L;             ///< Cholesky factor of H restricted to the positive variables
+    vector_t                   m_z;             ///< minimizer restricted to the positive variables
+    vector_t                   m_hq;            ///< buffer: H^-1 * q (restricted to the positive variables)
+    vector_t                   m_h1;            ///< buffer: H^-1 * 1 (restricted to the positive variables)
+    scalar_t                   m_mu{0.0};       ///< Lagrange multiplier of the equality constraint
+    tensor_size_t              m_iterations{0}; ///<
+};
+} // namespace nano
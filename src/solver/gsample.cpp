@@ -20,6 +20,8 @@ base_solver_gs_t<tsampler, tpreconditioner>::base_solver_gs_t()
     register_parameter(parameter_t::make_scalar(basename + "lsearch_gamma", 0, LT, 0.5, LT, 1));
     register_parameter(parameter_t::make_scalar(basename + "lsearch_perturb_c", 0, LE, 1e-6, LT, 1));
     register_parameter(parameter_t::make_integer(basename + "lsearch_max_iters", 0, LT, 50, LE, 100));
+
+    register_parameter(parameter_t::make_integer(basename + "seed", 0, LE, 42, LE, 1024));
 }
 
 template <class tsampler, class tpreconditioner>
@@ -42,6 +44,7 @@ solver_state_t base_solver_gs_t<tsampler, tpreconditioner>::do_minimize(const fu
     const auto epsilon0      = parameter(basename + "epsilon0").template value<scalar_t>();
     const auto theta_miu     = parameter(basename + "theta_miu").template value<scalar_t>();
     const auto theta_epsilon = parameter(basename + "theta_epsilon").template value<scalar_t>();
+    const auto seed          = parameter(basename + "seed").template value<uint64_t>();
 
     const auto n = function.size();
 
@@ -50,7 +53,7 @@ solver_state_t base_solver_gs_t<tsampler, tpreconditioner>::do_minimize(const fu
     auto miuk     = miu0;
     auto epsilonk = epsilon0;
     auto state    = solver_state_t{function, x0};
-    auto sampler  = tsampler{n};
+    auto sampler  = tsampler{n, seed};
     auto precond  = tpreconditioner{n};
     auto lsearch  = gsample::lsearch_t{n, *this, basename};
 
@@ -24,6 +24,11 @@ namespace nano
 /// NB: additionally the line-search implementation use the idea from (4)
 ///     to handle functions that are non-Lipschitz locally.
 ///
+/// NB: the sample points are drawn with a seeded random number generator (reproducible results) and
+///     their gradients are evaluated at once (e.g. in parallel if the function is reentrant).
+/// NB: the quadratic program of the stabilized gradient is solved with an active-set method
+///     warm-started from the solution of the previous iteration.
+///
 
 namespace gsample
 {
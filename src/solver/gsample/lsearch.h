@@ -11,7 +11,8 @@ public:
         : m_beta(configurable.parameter(basename + "lsearch_beta").value<scalar_t>())
         , m_gamma(configurable.parameter(basename + "lsearch_gamma").value<scalar_t>())
         , m_max_iters(configurable.parameter(basename + "lsearch_max_iters").value<tensor_size_t>())
-        , m_perturbation(n, configurable.parameter(basename + "lsearch_perturb_c").value<scalar_t>())
+        , m_perturbation(n, configurable.parameter(basename + "lsearch_perturb_c").value<scalar_t>(),
+                         configurable.parameter(basename + "seed").value<uint64_t>())
     {
     }
 
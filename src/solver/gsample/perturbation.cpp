@@ -4,10 +4,11 @@
 using namespace nano;
 using namespace nano::gsample;
 
-perturbation_t::perturbation_t(const tensor_size_t n, const scalar_t c)
+perturbation_t::perturbation_t(const tensor_size_t n, const scalar_t c, const uint64_t seed)
     : m_zero(vector_t::zero(n))
     , m_ksi(n)
     , m_c(c)
+    , m_rng(make_rng(seed))
 {
 }
 
@@ -17,8 +18,7 @@ const vector_t& perturbation_t::generate(const solver_state_t& state, const vect
     assert(std::isfinite(radius));
     assert(radius > 0.0);
 
-    auto rng = make_rng();
-    sample_from_ball(m_zero, radius, m_ksi, rng);
+    sample_from_ball(m_zero, radius, m_ksi, m_rng);
 
     return m_ksi;
 }
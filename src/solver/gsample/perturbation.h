@@ -1,5 +1,6 @@
 #pragma once
 
+#include <nano/core/random.h>
 #include <nano/solver/state.h>
 
 namespace nano::gsample
@@ -7,7 +8,7 @@ namespace nano::gsample
 class perturbation_t
 {
 public:
-    perturbation_t(tensor_size_t n, scalar_t c);
+    perturbation_t(tensor_size_t n, scalar_t c, uint64_t seed);
 
     const vector_t& generate(const solver_state_t& state, const vector_t& g);
 
@@ -16,5 +17,6 @@ private:
     vector_t m_zero;
     vector_t m_ksi;
     scalar_t m_c{1e-6};
+    rng_t    m_rng;
 };
 } // namespace nano::gsample
@@ -8,13 +8,29 @@
 using namespace nano;
 using namespace nano::gsample;
 
-sampler_t::sampler_t(const tensor_size_t n)
+sampler_t::sampler_t(const tensor_size_t n, const uint64_t seed)
     : m_X(2 * n + 1, n)
     , m_G(2 * n + 1, n)
+    , m_seed(seed)
     , m_solver(solver_t::all().get("ipm"))
 {
 }
 
+void sampler_t::draw(const solver_state_t& state, const scalar_t epsilon, const tensor_size_t begin,
+                     const tensor_size_t end)
+{
+    // NB: each sample point has its own random number generator, so the sampling is reproducible.
+    for (tensor_size_t i = begin; i < end; ++i)
+    {
+        auto rng = make_rng(m_seed++);
+        sample_from_ball(state.x(), epsilon, m_X.tensor(i), rng);
+    }
+
+    // NB: evaluate all samples at once (e.g. in parallel or with a single pass over the data)
+    m_fx.resize(end - begin);
+    state.function().evaluate(m_X.slice(begin, end), m_fx, m_G.slice(begin, end));
+}
+
 quadratic_program_t sampler_t::make_program(const tensor_size_t p)
 {
     auto program = quadratic_program_t{"gsample-qp", matrix_t{matrix_t::zero(p, p)}, vector_t{vector_t::zero(p)}};
@@ -25,9 +41,8 @@ quadratic_program_t sampler_t::make_program(const tensor_size_t p)
     return program;
 }
 
-fixed_sampler_t::fixed_sampler_t(const tensor_size_t n)
-    : sampler_t(n)
-    , m_program(make_program(m_G.rows()))
+fixed_sampler_t::fixed_sampler_t(const tensor_size_t n, const uint64_t seed)
+    : sampler_t(n, seed)
 {
 }
 
@@ -35,13 +50,8 @@ void fixed_sampler_t::sample(const solver_state_t& state, const scalar_t epsilon
 {
     const auto m = m_G.rows() - 1;
 
-    m_psize  = 0;
-    auto rng = make_rng();
-    for (tensor_size_t i = 0; i < m; ++i, ++m_psize)
-    {
-        sample_from_ball(state.x(), epsilon, m_X.tensor(i), rng);
-        state.function()(m_X.tensor(i), m_G.tensor(i));
-    }
+    draw(state, epsilon, 0, m);
+    m_psize = m;
 
     m_X.tensor(m) = state.x();
     m_G.tensor(m) = state.gx();
@@ -51,8 +61,8 @@ void fixed_sampler_t::sample(const solver_state_t& state, const scalar_t epsilon
     assert(m_psize == m_G.rows());
 }
 
-adaptive_sampler_t::adaptive_sampler_t(const tensor_size_t n)
-    : sampler_t(n)
+adaptive_sampler_t::adaptive_sampler_t(const tensor_size_t n, const uint64_t seed)
+    : sampler_t(n, seed)
 {
 }
 
@@ -77,11 +87,7 @@ void adaptive_sampler_t::sample(const solver_state_t& state, const scalar_t epsi
     ++m_psize;
 
     // new samples
-    auto rng = make_rng();
-    for (tensor_size_t i = 0; i < phat; ++i, ++m_psize)
-    {
-        assert(m_psize < p);
-        sample_from_ball(state.x(), epsilon, m_X.tensor(m_psize), rng);
-        state.function()(m_X.tensor(m_psize), m_G.tensor(m_psize));
-    }
+    assert(m_psize + phat <= p);
+    draw(state, epsilon, m_psize, m_psize + phat);
+    m_psize += phat;
 }
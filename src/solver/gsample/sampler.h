@@ -2,6 +2,7 @@
 
 #include <nano/function/quadratic.h>
 #include <nano/solver.h>
+#include <solver/bundle/simplex.h>
 
 using namespace nano;
 
@@ -9,29 +10,56 @@ namespace nano::gsample
 {
 struct sampler_t
 {
-    explicit sampler_t(tensor_size_t n);
+    sampler_t(tensor_size_t n, uint64_t seed);
 
     template <class tmatrix>
-    void descent(quadratic_program_t& program, const tmatrix& W, vector_t& g, const logger_t& logger)
+    void descent(const tmatrix& W, vector_t& g, const logger_t& logger)
     {
         const auto G = m_G.slice(0, m_psize);
-        program.Q()  = G * W * G.transpose();
-
-        const auto x0    = vector_t::constant(m_psize, 1.0 / static_cast<scalar_t>(m_psize));
-        const auto state = m_solver->minimize(program, x0, logger);
-        // FIXME: this cannot be guaranteed, better to show a warning!
-        // assert(state.status() == solver_status::converged);
-        g = G.transpose() * state.x();
+        m_H          = G * W * G.transpose();
+        m_q          = vector_t::zero(m_psize);
+
+        // NB: warm-start from the previous solution if the number of samples hasn't changed.
+        if (m_alphas.size() != m_psize)
+        {
+            m_alphas = vector_t::constant(m_psize, 1.0 / static_cast<scalar_t>(m_psize));
+        }
+
+        if (!m_qp.solve(m_H, m_q, m_alphas))
+        {
+            // NB: fallback to the generic interior-point solver if the active-set solver fails.
+            auto program = make_program(m_psize);
+            program.Q()  = m_H;
+
+            const auto x0    = vector_t::constant(m_psize, 1.0 / static_cast<scalar_t>(m_psize));
+            const auto state = m_solver->minimize(program, x0, logger);
+            // FIXME: this cannot be guaranteed, better to show a warning!
+            // assert(state.status() == solver_status::converged);
+            m_alphas = state.x();
+        }
+
+        g = G.transpose() * m_alphas;
         g = W * g;
     }
 
     static quadratic_program_t make_program(tensor_size_t p);
 
+    ///
+    /// \brief sample the points [begin, end) from the ball of the given radius and evaluate their gradients.
+    ///
+    void draw(const solver_state_t& state, scalar_t epsilon, tensor_size_t begin, tensor_size_t end);
+
     // attributes
     matrix_t      m_X;        ///< buffer of sample points (p, n)
     matrix_t      m_G;        ///< buffer of sample gradients (p, n)
+    vector_t      m_fx;       ///< buffer of sample function values
     tensor_size_t m_psize{0}; ///< current number of samples
-    rsolver_t     m_solver;   ///< solver for the quadratic program to compute the sample gradient
+    uint64_t      m_seed{0};  ///< seed of the random number generator of the next sample point
+    rsolver_t     m_solver;   ///< fallback solver for the quadratic program to compute the sample gradient
+    simplex_qp_t  m_qp;       ///< warm-started active-set solver for the quadratic program
+    matrix_t      m_H;        ///< buffer: Hessian of the quadratic program
+    vector_t      m_q;        ///< buffer: linear term of the quadratic program (zero)
+    vector_t      m_alphas;   ///< solution of the quadratic program (convex combination of the sample gradients)
 };
 
 ///
@@ -40,21 +68,11 @@ struct sampler_t
 class fixed_sampler_t final : public sampler_t
 {
 public:
-    explicit fixed_sampler_t(tensor_size_t n);
+    fixed_sampler_t(tensor_size_t n, uint64_t seed);
 
     static auto str() { return "gs"; }
 
     void sample(const solver_state_t& state, scalar_t epsilon);
-
-    template <class tmatrix>
-    void descent(const tmatrix& W, vector_t& g, const logger_t& logger)
-    {
-        sampler_t::descent(m_program, W, g, logger);
-    }
-
-private:
-    // attributes
-    quadratic_program_t m_program;
 };
 
 ///
@@ -64,17 +82,10 @@ private:
 class adaptive_sampler_t final : public sampler_t
 {
 public:
-    explicit adaptive_sampler_t(tensor_size_t n);
+    adaptive_sampler_t(tensor_size_t n, uint64_t seed);
 
     static auto str() { return "ags"; }
 
     void sample(const solver_state_t& state, scalar_t epsilon);
-
-    template <class tmatrix>
-    void descent(const tmatrix& W, vector_t& g, const logger_t& logger)
-    {
-        auto program = make_program(m_psize);
-        sampler_t::descent(program, W, g, logger);
-    }
 };
 } // namespace nano::gsample
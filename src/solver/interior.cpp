@@ -3,6 +3,14 @@
 
 using namespace nano;
 
+namespace
+{
+auto density(const tensor_size_t nonzeros, const tensor_size_t rows, const tensor_size_t cols)
+{
+    return rows * cols == 0 ? 0.0 : static_cast<scalar_t>(nonzeros) / static_cast<scalar_t>(rows * cols);
+}
+} // namespace
+
 solver_ipm_t::solver_ipm_t()
     : solver_t("ipm")
 {
@@ -11,6 +19,8 @@ solver_ipm_t::solver_ipm_t()
     register_parameter(parameter_t::make_scalar("solver::ipm::accuracy_epsilon", 0.0, LT, 1e-7, LE, 1e-6));
     register_parameter(parameter_t::make_scalar("solver::ipm::residual_epsilon", 0.0, LT, 1e-18, LE, 1e-6));
     register_parameter(parameter_t::make_integer("solver::ipm::residual_patience", 0, LT, 7, LE, 100));
+    register_parameter(parameter_t::make_integer("solver::ipm::sparse_size", 0, LE, 1000, LE, 1000000000));
+    register_parameter(parameter_t::make_scalar("solver::ipm::sparse_density", 0.0, LE, 0.01, LE, 1.0));
 
     parameter("solver::max_evals") = 100;
 }
@@ -22,15 +32,37 @@ rsolver_t solver_ipm_t::clone() const
 
 solver_state_t solver_ipm_t::do_minimize(const function_t& function, const vector_t& x0, const logger_t& logger) const
 {
-    if (auto lconstraints = make_linear_constraints(function); !lconstraints)
+    const auto sparse_size    = parameter("solver::ipm::sparse_size").value<tensor_size_t>();
+    const auto sparse_density = parameter("solver::ipm::sparse_density").value<scalar_t>();
+
+    auto sconstraints = make_sparse_linear_constraints(function);
+    if (!sconstraints)
     {
         raise("interior point solver can only solve linearly-constrained functions!");
     }
 
+    const auto& A = sconstraints->m_A;
+    const auto& G = sconstraints->m_G;
+
+    // NB: use the sparse representation only if the program is large enough and has few non-zeros,
+    //  otherwise the dense decomposition is faster.
+    const auto is_sparse = [&](const tensor_size_t Qnonzeros)
+    {
+        const auto n        = function.size();
+        const auto nonzeros = Qnonzeros + A.nonZeros() + G.nonZeros();
+        return n >= sparse_size && ::density(nonzeros, n + A.rows() + G.rows(), n) <= sparse_density;
+    };
+
     // linear programs
-    else if (const auto* const lprogram = dynamic_cast<const linear_program_t*>(&function); lprogram)
+    if (const auto* const lprogram = dynamic_cast<const linear_program_t*>(&function); lprogram)
     {
-        auto program = program_t{*lprogram, std::move(lconstraints.value()), x0};
+        if (is_sparse(0))
+        {
+            auto program = program_t{*lprogram, std::move(sconstraints.value()), x0};
+            return do_minimize(program, logger);
+        }
+
+        auto program = program_t{*lprogram, make_linear_constraints(function).value(), x0};
         return do_minimize(program, logger);
     }
 
@@ -39,7 +71,13 @@ solver_state_t solver_ipm_t::do_minimize(const function_t& function, const vecto
     {
         critical(is_convex(qprogram->Q()), "interior point solver can only solve convex quadratic programs!");
 
-        auto program = program_t{*qprogram, std::move(lconstraints.value()), x0};
+        if (is_sparse((qprogram->Q().array() != 0.0).count()))
+        {
+            auto program = program_t{*qprogram, std::move(sconstraints.value()), x0};
+            return do_minimize(program, logger);
+        }
+
+        auto program = program_t{*qprogram, make_linear_constraints(function).value(), x0};
         return do_minimize(program, logger);
     }
 
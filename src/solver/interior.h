@@ -16,6 +16,8 @@ namespace nano
 /// NB: the implementation follows the notation from (3).
 /// NB: the matrices are scaled using the modified Ruiz equilibration from (4).
 /// NB: the maximum allowed step length is decreasing geometrically: 1 - (1 - tau0) / (iteration + 1)^gamma.
+/// NB: the matrices are stored sparsely and the KKT system is solved with a sparse LDL^T decomposition
+///     for large programs (at least `sparse_size` variables) with few non-zeros (at most `sparse_density`).
 ///
 class NANO_PUBLIC solver_ipm_t final : public solver_t
 {
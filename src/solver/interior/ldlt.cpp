@@ -0,0 +1,193 @@
+#include <Eigen/OrderingMethods>
+#include <solver/interior/ldlt.h>
+
+using namespace nano;
+
+void sparse_ldlt_t::permute(const sparse_matrix_t& lower)
+{
+    m_C.resize(lower.rows(), lower.cols());
+    m_C.selfadjointView<Eigen::Upper>() = lower.selfadjointView<Eigen::Lower>().twistedBy(m_P);
+}
+
+void sparse_ldlt_t::analyze(const sparse_matrix_t& lower)
+{
+    assert(lower.rows() == lower.cols());
+
+    const auto n = lower.rows();
+
+    // fill-reducing ordering
+    {
+        const sparse_matrix_t full = lower.selfadjointView<Eigen::Lower>();
+
+        auto ordering = Eigen::AMDOrdering<int>{};
+        ordering(full, m_Pinv);
+        m_P = m_Pinv.inverse();
+    }
+
+    permute(lower);
+
+    // elimination tree and number of non-zeros of each column of L, see (2)
+    const auto* const Cp = m_C.outerIndexPtr();
+    const auto* const Ci = m_C.innerIndexPtr();
+
+    m_etree.resize(n);
+    m_Lnz.resize(n);
+    m_next.resize(n);
+
+    m_etree.full(-1);
+    m_Lnz.zero();
+    m_next.zero();
+
+    for (tensor_size_t j = 0; j < n; ++j)
+    {
+        m_next(j) = j;
+        for (auto k = Cp[j]; k < Cp[j + 1]; ++k)
+        {
+            for (tensor_size_t i = Ci[k]; i < j && m_next(i) != j; i = m_etree(i))
+            {
+                if (m_etree(i) == -1)
+                {
+                    m_etree(i) = j;
+                }
+                ++m_Lnz(i);
+                m_next(i) = j;
+            }
+        }
+    }
+
+    m_Lp.resize(n + 1);
+    m_Lp(0) = 0;
+    for (tensor_size_t i = 0; i < n; ++i)
+    {
+        m_Lp(i + 1) = m_Lp(i) + m_Lnz(i);
+    }
+
+    m_Li.resize(m_Lp(n));
+    m_Lx.resize(m_Lp(n));
+    m_D.resize(n);
+    m_Dinv.resize(n);
+    m_yidx.resize(n);
+    m_elim.resize(n);
+    m_yval.resize(n);
+    m_ymark.assign(static_cast<size_t>(n), false);
+
+    m_nonzeros = lower.nonZeros();
+}
+
+bool sparse_ldlt_t::factorize(const sparse_matrix_t& lower, const vector_t& signs, const scalar_t epsilon,
+                              const scalar_t delta)
+{
+    assert(lower.nonZeros() == m_nonzeros);
+    assert(signs.size() == lower.rows());
+
+    const auto n = lower.rows();
+
+    permute(lower);
+
+    const auto* const Cp = m_C.outerIndexPtr();
+    const auto* const Ci = m_C.innerIndexPtr();
+    const auto* const Cx = m_C.valuePtr();
+
+    m_yval.zero();
+    m_regularized = 0;
+    for (tensor_size_t i = 0; i < n; ++i)
+    {
+        m_next(i) = m_Lp(i);
+    }
+
+    // up-looking factorization: compute the k-th row of L and the k-th pivot, see (2)
+    for (tensor_size_t k = 0; k < n; ++k)
+    {
+        m_D(k) = 0.0;
+
+        // non-zero pattern of the k-th row of L (in topological order)
+        tensor_size_t nnzy = 0;
+        for (auto p = Cp[k]; p < Cp[k + 1]; ++p)
+        {
+            const tensor_size_t i = Ci[p];
+            if (i == k)
+            {
+                m_D(k) = Cx[p];
+                continue;
+            }
+
+            m_yval(i) = Cx[p];
+
+            tensor_size_t nnze = 0;
+            for (auto j = i; j != -1 && j < k && !m_ymark[static_cast<size_t>(j)]; j = m_etree(j))
+            {
+                m_ymark[static_cast<size_t>(j)] = true;
+                m_elim(nnze++)                  = j;
+            }
+            while (nnze > 0)
+            {
+                m_yidx(nnzy++) = m_elim(--nnze);
+            }
+        }
+
+        // sparse triangular solve
+        for (auto t = nnzy - 1; t >= 0; --t)
+        {
+            const auto j  = m_yidx(t);
+            const auto yj = m_yval(j);
+            for (auto p = m_Lp(j); p < m_next(j); ++p)
+            {
+                m_yval(m_Li(p)) -= m_Lx(p) * yj;
+            }
+
+            const auto p = m_next(j)++;
+            m_Li(p)      = k;
+            m_Lx(p)      = yj * m_Dinv(j);
+            m_D(k) -= yj * m_Lx(p);
+
+            m_yval(j)                       = 0.0;
+            m_ymark[static_cast<size_t>(j)] = false;
+        }
+
+        // pivot with the wrong sign (or too small) because of round-off errors
+        const auto sign = signs(m_Pinv.indices()(k));
+        if (sign * m_D(k) <= epsilon)
+        {
+            m_D(k) = sign * delta;
+            ++m_regularized;
+        }
+
+        if (!std::isfinite(m_D(k)))
+        {
+            return false;
+        }
+        m_Dinv(k) = 1.0 / m_D(k);
+    }
+
+    return true;
+}
+
+eigen_vector_t<scalar_t> sparse_ldlt_t::solve(vector_cref_t b) const
+{
+    const auto n = m_D.size();
+
+    eigen_vector_t<scalar_t> x = m_P * b;
+
+    // L * z = P * b
+    for (tensor_size_t i = 0; i < n; ++i)
+    {
+        for (auto p = m_Lp(i); p < m_Lp(i + 1); ++p)
+        {
+            x(m_Li(p)) -= m_Lx(p) * x(i);
+        }
+    }
+
+    // D * y = z
+    x.array() *= m_Dinv.array();
+
+    // L^T * x = y
+    for (auto i = n - 1; i >= 0; --i)
+    {
+        for (auto p = m_Lp(i); p < m_Lp(i + 1); ++p)
+        {
+            x(i) -= m_Lx(p) * x(m_Li(p));
+        }
+    }
+
+    return m_Pinv * x;
+}
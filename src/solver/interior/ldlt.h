@@ -0,0 +1,97 @@
+#pragma once
+
+#include <Eigen/SparseCore>
+#include <nano/tensor.h>
+
+namespace nano
+{
+///
+/// \brief sparse LDL^T decomposition of symmetric quasi-definite matrices like the (regularized) KKT systems
+///     of the primal-dual interior-point method:
+///         |H + delta1 * I         A^T    |
+///         |      A          -delta2 * I  |
+///
+/// see (1) "Quasi-definite matrices", by R. Vanderbei, 1995.
+/// see (2) "QDLDL: a free LDL factorization routine", by P. Goulart, B. Stellato et al., 2018-2020.
+/// see (3) "Algorithm 837: AMD, an approximate minimum degree ordering algorithm", by P. Amestoy et al., 2004.
+///
+/// NB: the implementation follows the up-looking algorithm from (2) with the fill-reducing ordering from (3).
+///
+/// NB: the symbolic analysis (the ordering, the elimination tree and the sparsity pattern of L) is computed only once
+///     and it is reused by the numerical factorization as long as the sparsity pattern doesn't change.
+///
+/// NB: the sign of each pivot is known a-priori for quasi-definite matrices, so the pivots that have the wrong sign
+///     or are too small because of round-off errors are replaced with a given value of the correct sign:
+///     either a small value (regularization) or a huge value (to zero the associated components of the solution).
+///     the resulting perturbation is typically removed with a few steps of iterative refinement.
+///
+class NANO_PUBLIC sparse_ldlt_t
+{
+public:
+    using sparse_matrix_t = Eigen::SparseMatrix<scalar_t>;
+    using vector_cref_t   = Eigen::Ref<const eigen_vector_t<scalar_t>>;
+
+    ///
+    /// \brief constructor
+    ///
+    sparse_ldlt_t() = default;
+
+    ///
+    /// \brief compute the symbolic decomposition given the lower triangular part of the matrix.
+    ///
+    void analyze(const sparse_matrix_t& lower);
+
+    ///
+    /// \brief compute the numerical decomposition given the lower triangular part of the matrix
+    ///     (with the same sparsity pattern as the analyzed matrix) and the expected signs of the pivots.
+    ///
+    /// NB: the pivots `d` with `sign * d <= epsilon` are replaced with `sign * delta`.
+    /// NB: returns false if the decomposition is not finite.
+    ///
+    bool factorize(const sparse_matrix_t& lower, const vector_t& signs, scalar_t epsilon, scalar_t delta);
+
+    ///
+    /// \brief solve the linear system of equations using the current decomposition.
+    ///
+    eigen_vector_t<scalar_t> solve(vector_cref_t b) const;
+
+    ///
+    /// \brief returns the diagonal factor D (in the permuted order).
+    ///
+    const vector_t& D() const { return m_D; }
+
+    ///
+    /// \brief returns the number of non-zeros of the analyzed matrix (lower triangular part).
+    ///
+    tensor_size_t nonzeros() const { return m_nonzeros; }
+
+    ///
+    /// \brief returns the number of pivots replaced during the last numerical factorization.
+    ///
+    tensor_size_t regularized() const { return m_regularized; }
+
+private:
+    using permutation_t = Eigen::PermutationMatrix<Eigen::Dynamic, Eigen::Dynamic, int>;
+
+    void permute(const sparse_matrix_t& lower);
+
+    // attributes
+    tensor_size_t     m_nonzeros{-1};   ///< number of non-zeros of the analyzed matrix
+    tensor_size_t     m_regularized{0}; ///< number of replaced pivots
+    permutation_t     m_P;              ///< fill-reducing permutation
+    permutation_t     m_Pinv;           ///< inverse of the fill-reducing permutation
+    sparse_matrix_t   m_C;              ///< permuted matrix (upper triangular part)
+    indices_t         m_etree;          ///< elimination tree
+    indices_t         m_Lnz;            ///< number of non-zeros of each column of L
+    indices_t         m_Lp;             ///< column offsets of L
+    indices_t         m_Li;             ///< row indices of L
+    vector_t          m_Lx;             ///< values of L
+    vector_t          m_D;              ///< diagonal factor
+    vector_t          m_Dinv;           ///< inverse of the diagonal factor
+    indices_t         m_next;           ///< buffer: next free position in each column of L
+    indices_t         m_yidx;           ///< buffer: non-zero pattern of the current row of L
+    indices_t         m_elim;           ///< buffer: elimination path
+    vector_t          m_yval;           ///< buffer: values of the current row of L
+    std::vector<bool> m_ymark;          ///< buffer: marks the non-zero pattern of the current row of L
+};
+} // namespace nano
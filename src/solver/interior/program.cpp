@@ -1,3 +1,4 @@
+#include <nano/core/numeric.h>
 #include <solver/interior/program.h>
 #include <solver/interior/util.h>
 
@@ -13,6 +14,16 @@ program_t::program_t(const quadratic_program_t& program, linear_constraints_t co
 {
 }
 
+program_t::program_t(const linear_program_t& program, sparse_linear_constraints_t constraints, const vector_t& x0)
+    : program_t(program, sparse_matrix_t(x0.size(), x0.size()), program.c(), std::move(constraints), x0)
+{
+}
+
+program_t::program_t(const quadratic_program_t& program, sparse_linear_constraints_t constraints, const vector_t& x0)
+    : program_t(program, sparse_matrix_t{program.Q().matrix().sparseView()}, program.c(), std::move(constraints), x0)
+{
+}
+
 program_t::program_t(const function_t& function, matrix_t Q, vector_t c, linear_constraints_t constraints,
                      const vector_t& x0)
     : m_function(function)
@@ -22,46 +33,85 @@ program_t::program_t(const function_t& function, matrix_t Q, vector_t c, linear_
     , m_h(std::move(constraints.m_h))
     , m_A(std::move(constraints.m_A))
     , m_b(std::move(constraints.m_b))
-    , m_x(vector_t::zero(n() + m()))
-    , m_u(vector_t::zero(m()))
-    , m_v(vector_t::zero(p() + m()))
-    , m_dx(vector_t::zero(m_x.size()))
-    , m_du(vector_t::zero(m_u.size()))
-    , m_dv(vector_t::zero(m_v.size()))
-    , m_dQ(vector_t::constant(n(), 1.0))
-    , m_dG(vector_t::constant(m(), 1.0))
-    , m_dA(vector_t::constant(p(), 1.0))
-    , m_rdual(n() + m())
-    , m_rcent(m())
-    , m_rprim(p() + m())
-    , m_orig_x(n())
-    , m_orig_u(m())
-    , m_orig_v(p())
     , m_lmat(n() + p(), n() + p())
-    , m_lvec(n() + p())
-    , m_lsol(n() + p())
 {
     assert(m_Q.rows() == n());
     assert(m_Q.cols() == n());
 
-    assert(m_c.size() == n());
-
     assert(m_A.rows() == p());
     assert(m_A.cols() == n());
-    assert(m_b.size() == p());
 
     assert(m_G.rows() == m());
     assert(m_G.cols() == n());
-    assert(m_h.size() == m());
 
-    ::nano::modified_ruiz_equilibration(m_dQ, m_Q, m_c, m_dG, m_G, m_h, m_dA, m_A, m_b);
+    initialize(x0);
+}
+
+program_t::program_t(const function_t& function, sparse_matrix_t Q, vector_t c, sparse_linear_constraints_t constraints,
+                     const vector_t& x0)
+    : m_function(function)
+    , m_c(std::move(c))
+    , m_h(std::move(constraints.m_h))
+    , m_b(std::move(constraints.m_b))
+    , m_sparse(true)
+    , m_sQ(std::move(Q))
+    , m_sG(std::move(constraints.m_G))
+    , m_sA(std::move(constraints.m_A))
+{
+    assert(m_sQ.rows() == n());
+    assert(m_sQ.cols() == n());
+
+    assert(m_sA.rows() == p());
+    assert(m_sA.cols() == n());
+
+    assert(m_sG.rows() == m());
+    assert(m_sG.cols() == n());
+
+    initialize(x0);
+}
+
+void program_t::initialize(const vector_t& x0)
+{
+    assert(x0.size() == n());
+
+    m_x      = vector_t::zero(n() + m());
+    m_u      = vector_t::zero(m());
+    m_v      = vector_t::zero(p() + m());
+    m_dx     = vector_t::zero(m_x.size());
+    m_du     = vector_t::zero(m_u.size());
+    m_dv     = vector_t::zero(m_v.size());
+    m_dQ     = vector_t::constant(n(), 1.0);
+    m_dG     = vector_t::constant(m(), 1.0);
+    m_dA     = vector_t::constant(p(), 1.0);
+    m_rdual  = vector_t{n() + m()};
+    m_rcent  = vector_t{m()};
+    m_rprim  = vector_t{p() + m()};
+    m_orig_x = vector_t{n()};
+    m_orig_u = vector_t{m()};
+    m_orig_v = vector_t{p()};
+    m_lvec   = vector_t{n() + p()};
+    m_lsol   = vector_t{n() + p()};
+    m_sdelta = vector_t{m_sparse ? n() + p() : 0};
+    m_ssigns = vector_t{m_sparse ? n() + p() : 0};
+
+    if (m_sparse)
+    {
+        m_ssigns.segment(0, n()).setConstant(+1.0);
+        m_ssigns.segment(n(), p()).setConstant(-1.0);
+
+        ::nano::modified_ruiz_equilibration(m_dQ, m_sQ, m_c, m_dG, m_sG, m_h, m_dA, m_sA, m_b);
+    }
+    else
+    {
+        ::nano::modified_ruiz_equilibration(m_dQ, m_Q, m_c, m_dG, m_G, m_h, m_dA, m_A, m_b);
+    }
 
     // initialize: see (2), p. 613, u = -1 / (G * x - h) = 1 / y
     auto [x, y, u, v, w]                       = unpack_vars();
     [[maybe_unused]] auto [dx, dy, du, dv, dw] = unpack_delta();
 
     x.array() = x0.array();
-    y.array() = (m_h - m_G * x0).array().abs().max(1.0);
+    y.array() = (m_h.vector() - mulG(x0.vector())).array().abs().max(1.0);
     u.array() = 1.0 / y.array();
     v.array() = 1.0;
     w.array() = u.array();
@@ -157,12 +207,15 @@ scalar_t program_t::primal_residual()
 {
     [[maybe_unused]] const auto [x, y, u, v, w] = unpack_vars();
 
-    const auto res1 = (m_A * x - m_b).lpNorm<Eigen::Infinity>();
-    const auto res2 = (m_G * x + y - m_h).lpNorm<Eigen::Infinity>();
+    const auto Ax = mulA(x);
+    const auto Gx = mulG(x);
+
+    const auto res1 = (Ax - m_b.vector()).lpNorm<Eigen::Infinity>();
+    const auto res2 = (Gx + y - m_h.vector()).lpNorm<Eigen::Infinity>();
 
-    const auto nom1 = (m_A * x).lpNorm<Eigen::Infinity>();
+    const auto nom1 = Ax.lpNorm<Eigen::Infinity>();
     const auto nom2 = m_b.lpNorm<Eigen::Infinity>();
-    const auto nom3 = (m_G * x).lpNorm<Eigen::Infinity>();
+    const auto nom3 = Gx.lpNorm<Eigen::Infinity>();
     const auto nom4 = m_h.lpNorm<Eigen::Infinity>();
     const auto nom5 = y.lpNorm<Eigen::Infinity>();
 
@@ -173,12 +226,16 @@ scalar_t program_t::dual_residual()
 {
     [[maybe_unused]] const auto [x, y, u, v, w] = unpack_vars();
 
-    const auto res1 = (m_Q * x + m_c + m_A.transpose() * v + m_G.transpose() * w).lpNorm<Eigen::Infinity>();
+    const auto Qx  = mulQ(x);
+    const auto Atv = mulAt(v);
+    const auto Gtw = mulGt(w);
+
+    const auto res1 = (Qx + m_c.vector() + Atv + Gtw).lpNorm<Eigen::Infinity>();
     const auto res2 = (w - u).lpNorm<Eigen::Infinity>();
 
-    const auto nom1 = (m_Q * x).lpNorm<Eigen::Infinity>();
-    const auto nom2 = (m_A.transpose() * v).lpNorm<Eigen::Infinity>();
-    const auto nom3 = (m_G.transpose() * w).lpNorm<Eigen::Infinity>();
+    const auto nom1 = Qx.lpNorm<Eigen::Infinity>();
+    const auto nom2 = Atv.lpNorm<Eigen::Infinity>();
+    const auto nom3 = Gtw.lpNorm<Eigen::Infinity>();
     const auto nom4 = m_c.lpNorm<Eigen::Infinity>();
 
     return std::max(res1, res2) / (1.0 + std::max({nom1, nom2, nom3, nom4}));
@@ -188,9 +245,11 @@ scalar_t program_t::duality_gap()
 {
     [[maybe_unused]] const auto [x, y, u, v, w] = unpack_vars();
 
-    const auto res1 = std::fabs(x.dot(m_Q * x + m_c) + m_b.dot(v) + m_h.dot(w));
+    const auto Qx = mulQ(x);
+
+    const auto res1 = std::fabs(x.dot(Qx + m_c.vector()) + m_b.dot(v) + m_h.dot(w));
 
-    const auto nom1 = std::fabs(x.dot(m_Q * x));
+    const auto nom1 = std::fabs(x.dot(Qx));
     const auto nom2 = std::fabs(x.dot(m_c.vector()));
     const auto nom3 = std::fabs(m_b.dot(v));
     const auto nom4 = std::fabs(m_h.dot(w));
@@ -206,11 +265,11 @@ void program_t::refine_solution(const logger_t& logger, const int max_iters, con
     auto best_solution = vector_t{m_lsol.size()};
     auto best_accuracy = std::numeric_limits<scalar_t>::max();
 
-    solution.vector() = m_solver.solve(m_lvec.vector());
+    solution.vector() = kkt_solve(m_lvec.vector());
 
     for (auto iter = 0, best_iteration = 0; iter < max_iters; ++iter)
     {
-        residual = m_lvec - m_lmat * solution;
+        residual.vector() = m_lvec.vector() - kkt_product(solution.vector());
 
         const auto accuracy = residual.lpNorm<2>();
         logger.info("kktrefine: iter=", iter, ",accuracy=", accuracy, ".\n");
@@ -235,7 +294,7 @@ void program_t::refine_solution(const logger_t& logger, const int max_iters, con
             }
         }
 
-        correction.vector() = m_solver.solve(residual.vector());
+        correction.vector() = kkt_solve(residual.vector());
         if (!correction.all_finite())
         {
             break;
@@ -265,24 +324,38 @@ program_t::kkt_stats_t program_t::solve(const logger_t& logger)
     // |A     0       0      0     0 |   |dvp|   |-rpp|
     // |G     I       0      0     0 |   |dvm|   |-rpm|
 
-    m_lvec.segment(0, n) = b1 - m_G.transpose() * (a7.array() / y.array()).matrix();
+    m_lvec.segment(0, n) = b1 - mulGt((a7.array() / y.array()).matrix());
     m_lvec.segment(n, p) = b4;
 
     refine_solution(logger);
 
-    const auto dx = m_lsol.segment(0, n);
-    const auto dv = m_lsol.segment(n, p);
-    const auto dw = a7.array() / y.array() + (u.array() / y.array()) * (m_G * dx).array();
+    const auto dx  = m_lsol.segment(0, n);
+    const auto dv  = m_lsol.segment(n, p);
+    const auto Gdx = mulG(dx);
+    const auto dw  = a7.array() / y.array() + (u.array() / y.array()) * Gdx.array();
 
     m_dx.segment(0, n) = dx;
-    m_dx.segment(n, m) = b5 - m_G * dx;
+    m_dx.segment(n, m) = b5 - Gdx;
     m_du.segment(0, m) = dw - b2.array();
     m_dv.segment(0, p) = dv;
     m_dv.segment(p, m) = dw;
 
     // verify solution
+    const auto accuracy = (kkt_product(m_lsol.vector()) - m_lvec.vector()).lpNorm<2>();
+    if (m_sparse)
+    {
+        // NB: the signs of the diagonal factor D give the inertia of the (regularized) matrix.
+        const auto D        = m_ssolver.D().array();
+        const auto valid    = m_svalid && m_lvec.all_finite() && m_lsol.all_finite();
+        const auto rcond    = D.size() == 0 ? 0.0 : D.abs().minCoeff() / D.abs().maxCoeff();
+        const auto positive = (D >= 0.0).all();
+        const auto negative = (D <= 0.0).all();
+
+        return kkt_stats_t{
+            .m_accuracy = accuracy, .m_rcond = rcond, .m_valid = valid, .m_positive = positive, .m_negative = negative};
+    }
+
     const auto valid    = m_lmat.all_finite() && m_lvec.all_finite() && m_lsol.all_finite();
-    const auto accuracy = (m_lmat * m_lsol - m_lvec).lpNorm<2>();
     const auto rcond    = m_solver.rcond();
     const auto positive = m_solver.isPositive();
     const auto negative = m_solver.isNegative();
@@ -302,12 +375,71 @@ void program_t::update_solver()
     // |A     0       0      0     0 |   |dvp|   |-rpp|
     // |G     I       0      0     0 |   |dvm|   |-rpm|
 
-    m_lmat.block(0, 0, n, n) = m_Q.matrix() + m_G.transpose() * (u.array() / y.array()).matrix().asDiagonal() * m_G;
-    m_lmat.block(0, n, n, p) = m_A.transpose();
-    m_lmat.block(n, 0, p, n) = m_A.matrix();
-    m_lmat.block(n, n, p, p) = matrix_t::zero(p, p);
+    if (m_sparse)
+    {
+        // NB: the structure of the reduced KKT system doesn't change (only the values do),
+        //  so the symbolic analysis is performed only once.
+        //
+        // NB: the pivots that lose their (expected) sign because of round-off errors are replaced with a huge value,
+        //  so that the corresponding components of the solution are zero (as in the LP interior-point codes).
+        //  the alternative of replacing them with a small value makes the iterative refinement diverge
+        //  close to the optimum, when the diagonal (u / y) spans many orders of magnitude.
+        const eigen_vector_t<scalar_t> d  = u.array() / y.array();
+        const sparse_matrix_t          DG = d.asDiagonal() * m_sG;
+        const sparse_matrix_t          H  = m_sQ + sparse_matrix_t{m_sG.transpose() * DG};
+
+        const auto delta1 = epsilon2<scalar_t>();
+        const auto delta2 = epsilon2<scalar_t>();
+        const auto dhuge  = 1e+64;
+
+        m_sdelta.segment(0, n).setConstant(+delta1);
+        m_sdelta.segment(n, p).setConstant(-delta2);
+
+        // |H + delta1 * I        0    |
+        // |      A        -delta2 * I |
+        m_striplets.clear();
+        m_striplets.reserve(static_cast<size_t>(H.nonZeros() + m_sA.nonZeros() + n + p));
+        for (Eigen::Index k = 0; k < H.outerSize(); ++k)
+        {
+            for (sparse_matrix_t::InnerIterator it(H, k); it; ++it)
+            {
+                if (it.row() >= it.col())
+                {
+                    m_striplets.emplace_back(it.row(), it.col(), it.value());
+                }
+            }
+        }
+        for (Eigen::Index k = 0; k < m_sA.outerSize(); ++k)
+        {
+            for (sparse_matrix_t::InnerIterator it(m_sA, k); it; ++it)
+            {
+                m_striplets.emplace_back(n + it.row(), it.col(), it.value());
+            }
+        }
+        for (tensor_size_t i = 0; i < n + p; ++i)
+        {
+            m_striplets.emplace_back(i, i, m_sdelta(i));
+        }
 
-    m_solver.compute(m_lmat.matrix());
+        m_slmat.resize(n + p, n + p);
+        m_slmat.setFromTriplets(m_striplets.begin(), m_striplets.end());
+
+        if (m_slmat.nonZeros() != m_ssolver.nonzeros())
+        {
+            m_ssolver.analyze(m_slmat);
+        }
+        m_svalid = m_slmat.coeffs().allFinite() && m_ssolver.factorize(m_slmat, m_ssigns, 0.5 * delta2, dhuge);
+    }
+    else
+    {
+        m_lmat.block(0, 0, n, n) =
+            m_Q.matrix() + m_G.transpose() * (u.array() / y.array()).matrix().asDiagonal() * m_G;
+        m_lmat.block(0, n, n, p) = m_A.transpose();
+        m_lmat.block(n, 0, p, n) = m_A.matrix();
+        m_lmat.block(n, n, p, p) = matrix_t::zero(p, p);
+
+        m_solver.compute(m_lmat.matrix());
+    }
 }
 
 void program_t::update_original()
@@ -325,14 +457,14 @@ void program_t::update_residual(const scalar_t sigma)
     const auto [x, y, u, v, w] = unpack_vars();
 
     // dual residual
-    m_rdual.segment(0, n).matrix() = m_Q * x + m_c;
-    m_rdual.segment(0, n) += m_A.transpose() * v;
-    m_rdual.segment(0, n) += m_G.transpose() * w;
+    m_rdual.segment(0, n) = mulQ(x) + m_c.vector();
+    m_rdual.segment(0, n) += mulAt(v);
+    m_rdual.segment(0, n) += mulGt(w);
     m_rdual.segment(n, m) = w - u;
 
     // primal residual
-    m_rprim.segment(0, p) = m_A * x - m_b;
-    m_rprim.segment(p, m) = m_G * x + y - m_h;
+    m_rprim.segment(0, p) = mulA(x) - m_b.vector();
+    m_rprim.segment(p, m) = mulG(x) + y - m_h.vector();
 
     // centering residual
     if (m > 0)
@@ -343,3 +475,67 @@ void program_t::update_residual(const scalar_t sigma)
         m_rcent.array() = u.array() * y.array() - sigma * y.dot(u) / static_cast<scalar_t>(m);
     }
 }
+
+eigen_vector_t<scalar_t> program_t::mulQ(vector_cref_t x) const
+{
+    if (m_sparse)
+    {
+        return m_sQ * x;
+    }
+    return m_Q.matrix() * x;
+}
+
+eigen_vector_t<scalar_t> program_t::mulG(vector_cref_t x) const
+{
+    if (m_sparse)
+    {
+        return m_sG * x;
+    }
+    return m_G.matrix() * x;
+}
+
+eigen_vector_t<scalar_t> program_t::mulA(vector_cref_t x) const
+{
+    if (m_sparse)
+    {
+        return m_sA * x;
+    }
+    return m_A.matrix() * x;
+}
+
+eigen_vector_t<scalar_t> program_t::mulGt(vector_cref_t w) const
+{
+    if (m_sparse)
+    {
+        return m_sG.transpose() * w;
+    }
+    return m_G.matrix().transpose() * w;
+}
+
+eigen_vector_t<scalar_t> program_t::mulAt(vector_cref_t v) const
+{
+    if (m_sparse)
+    {
+        return m_sA.transpose() * v;
+    }
+    return m_A.matrix().transpose() * v;
+}
+
+eigen_vector_t<scalar_t> program_t::kkt_solve(vector_cref_t b) const
+{
+    if (m_sparse)
+    {
+        return m_ssolver.solve(b);
+    }
+    return m_solver.solve(b);
+}
+
+eigen_vector_t<scalar_t> program_t::kkt_product(vector_cref_t x) const
+{
+    if (m_sparse)
+    {
+        // NB: the product with the original (not regularized) reduced KKT system.
+        return m_slmat.selfadjointView<Eigen::Lower>() * x - (m_sdelta.array() * x.array()).matrix();
+    }
+    return m_lmat.matrix() * x;
+}
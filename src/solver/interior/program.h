@@ -6,6 +6,7 @@
 #include <nano/function/quadratic.h>
 #include <nano/function/util.h>
 #include <nano/logger.h>
+#include <solver/interior/ldlt.h>
 
 namespace nano
 {
@@ -50,6 +51,13 @@ namespace nano
 ///     the primal variables are thus (x, y), while
 ///     the dual variables are (u for -y <= 0, v for A * x = b, w for G * x + y = h).
 ///
+/// NB: the matrices (Q, G, A) are stored either densely or sparsely (e.g. for large programs with few non-zeros).
+///     in the sparse case the reduced KKT system is regularized to be quasi-definite and
+///     it is solved with a sparse LDL^T decomposition (see sparse_ldlt_t), whose symbolic analysis is computed
+///     only once as only the values change between iterations.
+///
+///     the regularization is then removed with iterative refinement.
+///
 class program_t
 {
 public:
@@ -57,6 +65,10 @@ public:
 
     program_t(const quadratic_program_t&, linear_constraints_t, const vector_t& x0);
 
+    program_t(const linear_program_t&, sparse_linear_constraints_t, const vector_t& x0);
+
+    program_t(const quadratic_program_t&, sparse_linear_constraints_t, const vector_t& x0);
+
     const vector_t& original_x() const { return m_orig_x; }
 
     const vector_t& original_u() const { return m_orig_u; }
@@ -95,6 +107,20 @@ public:
 private:
     program_t(const function_t&, matrix_t Q, vector_t c, linear_constraints_t, const vector_t& x0);
 
+    program_t(const function_t&, sparse_matrix_t Q, vector_t c, sparse_linear_constraints_t, const vector_t& x0);
+
+    using vector_cref_t = Eigen::Ref<const eigen_vector_t<scalar_t>>;
+
+    void initialize(const vector_t& x0);
+
+    eigen_vector_t<scalar_t> mulQ(vector_cref_t x) const;
+    eigen_vector_t<scalar_t> mulG(vector_cref_t x) const;
+    eigen_vector_t<scalar_t> mulA(vector_cref_t x) const;
+    eigen_vector_t<scalar_t> mulGt(vector_cref_t w) const;
+    eigen_vector_t<scalar_t> mulAt(vector_cref_t v) const;
+    eigen_vector_t<scalar_t> kkt_solve(vector_cref_t b) const;
+    eigen_vector_t<scalar_t> kkt_product(vector_cref_t x) const;
+
     scalar_t duality_gap();
     scalar_t dual_residual();
     scalar_t primal_residual();
@@ -108,9 +134,9 @@ private:
 
     tensor_size_t n() const { return m_c.size(); }
 
-    tensor_size_t p() const { return m_A.rows(); }
+    tensor_size_t p() const { return m_b.size(); }
 
-    tensor_size_t m() const { return m_G.rows(); }
+    tensor_size_t m() const { return m_h.size(); }
 
     auto unpack_dims() const { return std::make_tuple(n(), m(), p()); }
 
@@ -132,37 +158,49 @@ private:
 
     using kkt_solver_t = Eigen::LDLT<eigen_matrix_t<scalar_t>>;
 
+    using triplets_t = std::vector<Eigen::Triplet<scalar_t>>;
+
     // using kkt_solver_t = Eigen::BiCGSTAB<eigen_matrix_t<scalar_t>, Eigen::DiagonalPreconditioner<scalar_t>>;
 
     // using kkt_solver_t = Eigen::ConjugateGradient<eigen_matrix_t<scalar_t>, Eigen::Lower | Eigen::Upper,
     //                                               Eigen::DiagonalPreconditioner<scalar_t>>;
 
     // attributes
-    const function_t& m_function; ///< original function to minimize
-    matrix_t          m_Q;        ///< objective: 1/2 * x.dot(Q * x) + c.dot(x)
-    vector_t          m_c;        ///<
-    matrix_t          m_G;        ///< inequality constraints: G * x <= h
-    vector_t          m_h;        ///<
-    matrix_t          m_A;        ///< equality constraints: A * x = b
-    vector_t          m_b;        ///<
-    vector_t          m_x;        ///< solution
-    vector_t          m_u;        ///< Lagrange multipliers for the inequality constraints
-    vector_t          m_v;        ///< Lagrange multipliers for the equality constraints
-    vector_t          m_dx;       ///< current variation of the solution
-    vector_t          m_du;       ///< current variation of Lagrange multipliers for the inequality constraints
-    vector_t          m_dv;       ///< current variation of Lagrange multipliers for the equality constraints
-    vector_t          m_dQ;       ///<
-    vector_t          m_dG;       ///<
-    vector_t          m_dA;       ///<
-    vector_t          m_rdual;    ///< dual residual
-    vector_t          m_rcent;    ///< centering residual
-    vector_t          m_rprim;    ///< primal residual
-    vector_t          m_orig_x;   ///< scaled solution
-    vector_t          m_orig_u;   ///< scaled Lagrange multipliers for the inequality constraints
-    vector_t          m_orig_v;   ///< scaled Lagrange multipliers for the equality constraints
-    matrix_t          m_lmat;     ///< reduced KKT system: lmat * lsol = lvec
-    vector_t          m_lvec;     ///<
-    vector_t          m_lsol;     ///<
-    kkt_solver_t      m_solver;   ///<
+    const function_t&   m_function;      ///< original function to minimize
+    matrix_t            m_Q;             ///< objective: 1/2 * x.dot(Q * x) + c.dot(x)
+    vector_t            m_c;             ///<
+    matrix_t            m_G;             ///< inequality constraints: G * x <= h
+    vector_t            m_h;             ///<
+    matrix_t            m_A;             ///< equality constraints: A * x = b
+    vector_t            m_b;             ///<
+    bool                m_sparse{false}; ///< whether the matrices (Q, G, A) are stored sparsely
+    sparse_matrix_t     m_sQ;            ///< sparse objective: 1/2 * x.dot(Q * x) + c.dot(x)
+    sparse_matrix_t     m_sG;            ///< sparse inequality constraints: G * x <= h
+    sparse_matrix_t     m_sA;            ///< sparse equality constraints: A * x = b
+    vector_t            m_x;             ///< solution
+    vector_t            m_u;             ///< Lagrange multipliers for the inequality constraints
+    vector_t            m_v;             ///< Lagrange multipliers for the equality constraints
+    vector_t            m_dx;            ///< current variation of the solution
+    vector_t            m_du;            ///< current variation of Lagrange multipliers for the inequality constraints
+    vector_t            m_dv;            ///< current variation of Lagrange multipliers for the equality constraints
+    vector_t            m_dQ;            ///<
+    vector_t            m_dG;            ///<
+    vector_t            m_dA;            ///<
+    vector_t            m_rdual;         ///< dual residual
+    vector_t            m_rcent;         ///< centering residual
+    vector_t            m_rprim;         ///< primal residual
+    vector_t            m_orig_x;        ///< scaled solution
+    vector_t            m_orig_u;        ///< scaled Lagrange multipliers for the inequality constraints
+    vector_t            m_orig_v;        ///< scaled Lagrange multipliers for the equality constraints
+    matrix_t            m_lmat;          ///< reduced KKT system: lmat * lsol = lvec
+    vector_t            m_lvec;          ///<
+    vector_t            m_lsol;          ///<
+    kkt_solver_t        m_solver;        ///<
+    sparse_matrix_t     m_slmat;         ///< sparse reduced KKT system (lower triangular part, regularized)
+    sparse_ldlt_t       m_ssolver;       ///<
+    vector_t            m_sdelta;        ///< regularization of the sparse reduced KKT system (diagonal)
+    vector_t            m_ssigns;        ///< expected signs of the pivots of the sparse reduced KKT system
+    bool                m_svalid{false}; ///< whether the sparse reduced KKT system was successfully decomposed
+    triplets_t          m_striplets;     ///< buffer to assemble the sparse reduced KKT system
 };
 } // namespace nano
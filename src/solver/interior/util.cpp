@@ -4,11 +4,7 @@ using namespace nano;
 
 namespace
 {
-template <class Qrow, class... Xrows>
-auto inorm(const Qrow& qrow, const Xrows&... xrows)
-{
-    return std::max({qrow.template lpNorm<Eigen::Infinity>(), (xrows.template lpNorm<Eigen::Infinity>(), ...)});
-}
+using sparse_matrix_t = Eigen::SparseMatrix<scalar_t>;
 
 template <class Qrow, class Grow, class Arow>
 auto delta(const Qrow& qrow, const Grow& grow, const Arow& arow)
@@ -26,11 +22,80 @@ void scale(const scalar_t row_norm, const scalar_t tau, scalar_t& current_scale)
         current_scale = 1.0 / std::sqrt(std::min(row_norm, 1.0 / tau));
     }
 }
-} // namespace
 
-void nano::modified_ruiz_equilibration(vector_t& dQ, matrix_t& Q, vector_t& c, vector_t& dG, matrix_t& G, vector_t& h,
-                                       vector_t& dA, matrix_t& A, vector_t& b, const scalar_t tau,
-                                       const scalar_t tolerance)
+auto row_norms(const matrix_t& M)
+{
+    auto norms = vector_t{M.rows()};
+    if (M.cols() == 0)
+    {
+        norms.zero();
+    }
+    else
+    {
+        norms.vector() = M.matrix().rowwise().lpNorm<Eigen::Infinity>();
+    }
+    return norms;
+}
+
+auto col_norms(const matrix_t& M)
+{
+    auto norms = vector_t{M.cols()};
+    if (M.rows() == 0)
+    {
+        norms.zero();
+    }
+    else
+    {
+        norms.vector() = M.matrix().colwise().lpNorm<Eigen::Infinity>().transpose();
+    }
+    return norms;
+}
+
+template <bool trows>
+auto inf_norms(const sparse_matrix_t& M)
+{
+    auto norms = vector_t{trows ? M.rows() : M.cols()};
+    norms.zero();
+    for (Eigen::Index k = 0; k < M.outerSize(); ++k)
+    {
+        for (sparse_matrix_t::InnerIterator it(M, k); it; ++it)
+        {
+            auto& norm = norms(trows ? it.row() : it.col());
+            norm       = std::max(norm, std::fabs(it.value()));
+        }
+    }
+    return norms;
+}
+
+auto row_norms(const sparse_matrix_t& M)
+{
+    return inf_norms<true>(M);
+}
+
+auto col_norms(const sparse_matrix_t& M)
+{
+    return inf_norms<false>(M);
+}
+
+void scale(matrix_t& M, const vector_t& rows, const vector_t& cols)
+{
+    M.matrix().noalias() = rows.vector().asDiagonal() * M * cols.vector().asDiagonal();
+}
+
+void scale(sparse_matrix_t& M, const vector_t& rows, const vector_t& cols)
+{
+    for (Eigen::Index k = 0; k < M.outerSize(); ++k)
+    {
+        for (sparse_matrix_t::InnerIterator it(M, k); it; ++it)
+        {
+            it.valueRef() = rows(it.row()) * it.value() * cols(it.col());
+        }
+    }
+}
+
+template <class tmatrix>
+void equilibrate(vector_t& dQ, tmatrix& Q, vector_t& c, vector_t& dG, tmatrix& G, vector_t& h, vector_t& dA, tmatrix& A,
+                 vector_t& b, const scalar_t tau, const scalar_t tolerance)
 {
     const auto n         = dQ.size();
     const auto m         = dG.size();
@@ -62,36 +127,35 @@ void nano::modified_ruiz_equilibration(vector_t& dQ, matrix_t& Q, vector_t& c, v
     for (auto k = 0; k < max_iters && (k == 0 || ::delta(cQ, cG, cA) > tolerance); ++k)
     {
         // matrix equilibration
-        for (tensor_size_t i = 0; i < n && !is_linear; ++i)
+        if (!is_linear && (m > 0 || p > 0))
         {
-            if (m > 0 && p > 0)
-            {
-                ::scale(::inorm(Q.row(i), G.col(i), A.col(i)), tau, cQ(i));
-            }
-            else if (m > 0)
+            const auto Qnorms = row_norms(Q);
+            const auto Gnorms = col_norms(G);
+            const auto Anorms = col_norms(A);
+            for (tensor_size_t i = 0; i < n; ++i)
             {
-                ::scale(::inorm(Q.row(i), G.col(i)), tau, cQ(i));
-            }
-            else if (p > 0)
-            {
-                ::scale(::inorm(Q.row(i), A.col(i)), tau, cQ(i));
+                ::scale(std::max({Qnorms(i), Gnorms(i), Anorms(i)}), tau, cQ(i));
             }
         }
+
+        const auto Gnorms = row_norms(G);
         for (tensor_size_t i = 0; i < m; ++i)
         {
-            ::scale(G.row(i).lpNorm<Eigen::Infinity>(), tau, cG(i));
+            ::scale(Gnorms(i), tau, cG(i));
         }
+
+        const auto Anorms = row_norms(A);
         for (tensor_size_t i = 0; i < p; ++i)
         {
-            ::scale(A.row(i).lpNorm<Eigen::Infinity>(), tau, cA(i));
+            ::scale(Anorms(i), tau, cA(i));
         }
 
         if (!is_linear)
         {
-            Q.matrix().noalias() = cQ.vector().asDiagonal() * Q * cQ.vector().asDiagonal();
+            ::scale(Q, cQ, cQ);
         }
-        G.matrix().noalias() = cG.vector().asDiagonal() * G * cQ.vector().asDiagonal();
-        A.matrix().noalias() = cA.vector().asDiagonal() * A * cQ.vector().asDiagonal();
+        ::scale(G, cG, cQ);
+        ::scale(A, cA, cQ);
 
         c.array() *= cQ.array();
         h.array() *= cG.array();
@@ -106,12 +170,12 @@ void nano::modified_ruiz_equilibration(vector_t& dQ, matrix_t& Q, vector_t& c, v
         dA.array() *= cA.array();
 
         // cost scaling
-        const auto Qnorm = is_linear ? 0.0 : Q.matrix().rowwise().lpNorm<Eigen::Infinity>().mean();
+        const auto Qnorm = is_linear ? 0.0 : row_norms(Q).vector().mean();
         const auto cnorm = c.lpNorm<Eigen::Infinity>();
         const auto gamma = 1.0 / std::max(Qnorm, cnorm);
 
         cc *= gamma;
-        Q.array() *= gamma;
+        Q *= gamma;
         c.array() *= gamma;
     }
 
@@ -119,3 +183,18 @@ void nano::modified_ruiz_equilibration(vector_t& dQ, matrix_t& Q, vector_t& c, v
     dG.array() /= cc;
     dA.array() /= cc;
 }
+} // namespace
+
+void nano::modified_ruiz_equilibration(vector_t& dQ, matrix_t& Q, vector_t& c, vector_t& dG, matrix_t& G, vector_t& h,
+                                       vector_t& dA, matrix_t& A, vector_t& b, const scalar_t tau,
+                                       const scalar_t tolerance)
+{
+    ::equilibrate(dQ, Q, c, dG, G, h, dA, A, b, tau, tolerance);
+}
+
+void nano::modified_ruiz_equilibration(vector_t& dQ, sparse_matrix_t& Q, vector_t& c, vector_t& dG, sparse_matrix_t& G,
+                                       vector_t& h, vector_t& dA, sparse_matrix_t& A, vector_t& b, const scalar_t tau,
+                                       const scalar_t tolerance)
+{
+    ::equilibrate(dQ, Q, c, dG, G, h, dA, A, b, tau, tolerance);
+}
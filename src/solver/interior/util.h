@@ -1,5 +1,6 @@
 #pragma once
 
+#include <Eigen/SparseCore>
 #include <nano/tensor.h>
 
 namespace nano
@@ -72,4 +73,14 @@ scalar_t make_umax(const tvectoru& u, const tvectordu& du, const scalar_t tau)
 NANO_PUBLIC void modified_ruiz_equilibration(vector_t& dQ, matrix_t& Q, vector_t& c, vector_t& dG, matrix_t& G,
                                              vector_t& h, vector_t& dA, matrix_t& A, vector_t& b, scalar_t tau = 1e-12,
                                              scalar_t tolerance = 1e-12);
+
+///
+/// \brief in-place modified Ruiz equilibration of the sparse matrices involved in a linear or quadratic program.
+///
+/// NB: the scaling factors are the same as for the dense matrices, but only the non-zero coefficients are processed.
+///
+NANO_PUBLIC void modified_ruiz_equilibration(vector_t& dQ, Eigen::SparseMatrix<scalar_t>& Q, vector_t& c, vector_t& dG,
+                                             Eigen::SparseMatrix<scalar_t>& G, vector_t& h, vector_t& dA,
+                                             Eigen::SparseMatrix<scalar_t>& A, vector_t& b, scalar_t tau = 1e-12,
+                                             scalar_t tolerance = 1e-12);
 } // namespace nano
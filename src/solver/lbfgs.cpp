@@ -1,8 +1,141 @@
-#include <deque>
 #include <solver/lbfgs.h>
 
 using namespace nano;
 
+namespace
+{
+///
+/// \brief fused update `x += alpha * y` followed by `return z.dot(x)`,
+///     processed in blocks small enough to stay in cache between the two operations.
+///
+template <class tx, class ty, class tz>
+scalar_t axpy_dot(tx&& x, const scalar_t alpha, const ty& y, const tz& z)
+{
+    constexpr auto block_size = tensor_size_t{2048};
+
+    auto dot = 0.0;
+    for (tensor_size_t begin = 0, size = x.size(); begin < size; begin += block_size)
+    {
+        const auto block = std::min(block_size, size - begin);
+
+        auto xb = x.segment(begin, block);
+        xb += alpha * y.segment(begin, block);
+        dot += z.segment(begin, block).dot(xb);
+    }
+    return dot;
+}
+
+///
+/// \brief preallocated ring buffer of the last pairs (s = dx, y = dg) stored contiguously as rows of (history x n)
+///     matrices, together with the cached values rho = 1 / s.dot(y).
+///
+class history_t
+{
+public:
+    history_t(const tensor_size_t history, const tensor_size_t size)
+        : m_S(history, size)
+        , m_Y(history, size)
+        , m_rho(history)
+        , m_alpha(history)
+    {
+    }
+
+    void clear() { m_size = 0; }
+
+    void push(const solver_state_t& prev, const solver_state_t& curr)
+    {
+        const auto capacity = m_S.rows();
+        const auto k        = (m_head + m_size) % capacity;
+
+        auto s = m_S.matrix().row(k);
+        auto y = m_Y.matrix().row(k);
+
+        s = curr.x().transpose() - prev.x().transpose();
+        y = curr.gx().transpose() - prev.gx().transpose();
+
+        m_rho(k) = 1.0 / s.dot(y);
+        m_yy     = y.squaredNorm();
+
+        if (m_size < capacity)
+        {
+            ++m_size;
+        }
+        else
+        {
+            m_head = (m_head + 1) % capacity;
+        }
+    }
+
+    ///
+    /// \brief compute in-place the product `H * q` using the two-loop recursion,
+    ///     see "Numerical optimization", Nocedal & Wright, 2nd edition, p.178.
+    ///
+    /// NB: each update of `q` is fused with the dot product needed by the next pair,
+    ///     so that `q` is streamed only once per pair.
+    ///
+    void apply(vector_t& q)
+    {
+        if (m_size == 0)
+        {
+            return;
+        }
+
+        const auto capacity = m_S.rows();
+        const auto index    = [&](const tensor_size_t i) { return (m_head + i) % capacity; };
+
+        auto q_ = q.vector();
+
+        // first loop: from the newest to the oldest pair
+        auto j  = index(m_size - 1);
+        auto sq = m_S.matrix().row(j).dot(q_);
+        for (auto i = m_size - 1; i >= 0; --i)
+        {
+            j            = index(i);
+            m_alpha(j)   = m_rho(j) * sq;
+            const auto y = m_Y.matrix().row(j).transpose();
+            if (i > 0)
+            {
+                sq = ::axpy_dot(q_, -m_alpha(j), y, m_S.matrix().row(index(i - 1)).transpose());
+            }
+            else
+            {
+                q_ -= m_alpha(j) * y;
+            }
+        }
+
+        // initial approximation: H0 = s.dot(y) / y.dot(y) * I (with the newest pair)
+        q_ *= 1.0 / (m_rho(index(m_size - 1)) * m_yy);
+
+        // second loop: from the oldest to the newest pair
+        auto yr = m_Y.matrix().row(index(0)).dot(q_);
+        for (tensor_size_t i = 0; i < m_size; ++i)
+        {
+            j               = index(i);
+            const auto beta = m_rho(j) * yr;
+            const auto s    = m_S.matrix().row(j).transpose();
+            if (i + 1 < m_size)
+            {
+                yr = ::axpy_dot(q_, m_alpha(j) - beta, s, m_Y.matrix().row(index(i + 1)).transpose());
+            }
+            else
+            {
+                q_ += (m_alpha(j) - beta) * s;
+            }
+        }
+    }
+
+private:
+    // attributes
+    matrix_t      m_S;       ///< variations of the solution (one per row)
+    matrix_t      m_Y;       ///< variations of the gradient (one per row)
+    vector_t      m_rho;     ///< 1 / s.dot(y) for each stored pair
+    vector_t      m_alpha;   ///< buffer: coefficients of the first loop
+    scalar_t      m_yy{0.0}; ///< y.dot(y) for the newest pair
+    tensor_size_t m_head{0}; ///< index of the oldest pair
+    tensor_size_t m_size{0}; ///< number of stored pairs
+};
+} // namespace
+
 solver_lbfgs_t::solver_lbfgs_t()
     : solver_t("lbfgs")
 {
@@ -28,7 +161,7 @@ solver_state_t solver_lbfgs_t::do_minimize(const function_t& function, const vec
     solver_t::warn_constrained(function, logger);
 
     const auto max_evals = parameter("solver::max_evals").value<tensor_size_t>();
-    const auto history   = parameter("solver::lbfgs::history").value<size_t>();
+    const auto history   = parameter("solver::lbfgs::history").value<tensor_size_t>();
 
     auto cstate = solver_state_t{function, x0}; // current state
     if (cstate.gx().lpNorm<Eigen::Infinity>() < epsilon0<scalar_t>())
@@ -40,51 +173,15 @@ solver_state_t solver_lbfgs_t::do_minimize(const function_t& function, const vec
     auto pstate  = cstate; // previous state
     auto lsearch = make_lsearch();
 
-    vector_t             q, r;
-    std::deque<vector_t> ss, ys;
+    // NB: all buffers are allocated once, so that the iterations don't allocate memory.
+    auto descent = vector_t{function.size()};
+    auto pairs   = history_t{history, function.size()};
     while (function.fcalls() + function.gcalls() < max_evals)
     {
         // descent direction
-        //      (see "Numerical optimization", Nocedal & Wright, 2nd edition, p.178)
-        q = cstate.gx();
-
-        const auto hsize = ss.size();
-
-        std::vector<scalar_t> alphas(hsize);
-        for (size_t j = 0; j < hsize; ++j)
-        {
-            const auto& s = ss[hsize - 1 - j];
-            const auto& y = ys[hsize - 1 - j];
-
-            const scalar_t alpha = s.dot(q) / s.dot(y);
-            q -= alpha * y;
-            alphas[j] = alpha;
-        }
-
-        if (ss.empty())
-        {
-            r = q;
-        }
-        else
-        {
-            const auto& s = ss[hsize - 1];
-            const auto& y = ys[hsize - 1];
-
-            r = s.dot(y) / y.dot(y) * q;
-        }
-
-        for (size_t j = 0; j < hsize; ++j)
-        {
-            const auto& s = ss[j];
-            const auto& y = ys[j];
-
-            const scalar_t alpha = alphas[hsize - 1 - j];
-            const scalar_t beta  = y.dot(r) / s.dot(y);
-            r += s * (alpha - beta);
-        }
-
-        auto& descent = r;
-        descent       = -r;
+        descent = cstate.gx();
+        pairs.apply(descent);
+        descent = -descent;
 
         // force descent direction
         const auto has_descent = cstate.has_descent(descent);
@@ -105,18 +202,11 @@ solver_state_t solver_lbfgs_t::do_minimize(const function_t& function, const vec
         //      "A Multi-Batch L-BFGS Method for Machine Learning", page 6 - the non-convex case
         if (has_descent)
         {
-            ss.emplace_back(cstate.x() - pstate.x());
-            ys.emplace_back(cstate.gx() - pstate.gx());
-            if (ss.size() > history)
-            {
-                ss.pop_front();
-                ys.pop_front();
-            }
+            pairs.push(pstate, cstate);
         }
         else
         {
-            ss.clear();
-            ys.clear();
+            pairs.clear();
         }
     }
 
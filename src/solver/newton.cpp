@@ -3,10 +3,61 @@
 
 using namespace nano;
 
+namespace
+{
+///
+/// \brief approximately solve the Newton system `H * d = -g` with conjugate gradients, see (1), algorithm 7.1.
+///
+/// NB: the iterations stop early if negative curvature is detected or if the residual is small enough.
+///
+void newton_cg(const function_t& function, const vector_t& x, const vector_t& g, vector_t& d, vector_t& r,
+               vector_t& p, vector_t& Hp, const tensor_size_t max_iters)
+{
+    const auto gnorm   = g.lpNorm<2>();
+    const auto epsilon = std::min(0.5, std::sqrt(gnorm)) * gnorm;
+
+    d.zero();
+    r = g;
+    p = -g;
+
+    auto rr = r.dot(r);
+    for (tensor_size_t iter = 0; iter < max_iters; ++iter)
+    {
+        function.hessian_vector(x, p, Hp);
+
+        const auto pHp = p.dot(Hp);
+        if (pHp <= 0.0)
+        {
+            if (iter == 0)
+            {
+                d = -g;
+            }
+            break;
+        }
+
+        const auto alpha = rr / pHp;
+        d.vector() += alpha * p.vector();
+        r.vector() += alpha * Hp.vector();
+
+        const auto rr_next = r.dot(r);
+        if (std::sqrt(rr_next) < epsilon)
+        {
+            break;
+        }
+
+        p.vector() = -r.vector() + (rr_next / rr) * p.vector();
+        rr         = rr_next;
+    }
+}
+} // namespace
+
 solver_newton_t::solver_newton_t()
     : solver_t("newton")
 {
     parameter("solver::tolerance") = std::make_tuple(1e-1, 9e-1);
+
+    register_parameter(parameter_t::make_enum("solver::newton::type", newton_type::ldlt));
+    register_parameter(parameter_t::make_integer("solver::newton::cg_max_iters", 1, LE, 100, LE, 1000000));
 }
 
 rsolver_t solver_newton_t::clone() const
@@ -26,7 +77,9 @@ solver_state_t solver_newton_t::do_minimize(const function_t& function, const ve
     solver_t::warn_nonsmooth(function, logger);
     solver_t::warn_constrained(function, logger);
 
-    const auto max_evals = parameter("solver::max_evals").value<tensor_size_t>();
+    const auto max_evals    = parameter("solver::max_evals").value<tensor_size_t>();
+    const auto type         = parameter("solver::newton::type").value<newton_type>();
+    const auto cg_max_iters = parameter("solver::newton::cg_max_iters").value<tensor_size_t>();
 
     // TODO: variant with computing the hessian's inverse every X(=5) iterations
 
@@ -40,16 +93,40 @@ solver_state_t solver_newton_t::do_minimize(const function_t& function, const ve
     auto pstate  = cstate;
     auto lsearch = make_lsearch();
     auto descent = vector_t{function.size()};
-    auto hessian = matrix_t{function.size(), function.size()};
+    auto hessian = matrix_t{};
     auto solver  = Eigen::LDLT<eigen_matrix_t<scalar_t>>{};
 
+    // NB: buffers for the Newton-CG iterations
+    auto r  = vector_t{};
+    auto p  = vector_t{};
+    auto Hp = vector_t{};
+
+    if (type == newton_type::cg)
+    {
+        r.resize(function.size());
+        p.resize(function.size());
+        Hp.resize(function.size());
+    }
+    else
+    {
+        hessian.resize(function.size(), function.size());
+    }
+
     while (function.fcalls() + function.gcalls() + function.hcalls() < max_evals)
     {
         // descent direction
-        function(cstate.x(), {}, hessian);
+        if (type == newton_type::cg)
+        {
+            ::newton_cg(function, cstate.x(), cstate.gx(), descent, r, p, Hp,
+                        std::min(cg_max_iters, function.size()));
+        }
+        else
+        {
+            function(cstate.x(), {}, hessian);
 
-        solver.compute(hessian.matrix());
-        descent.vector() = solver.solve(-cstate.gx());
+            solver.compute(hessian.matrix());
+            descent.vector() = solver.solve(-cstate.gx());
+        }
 
         // line-search
         pstate             = cstate;
@@ -4,10 +4,32 @@
 
 namespace nano
 {
+///
+/// \brief methods to compute the Newton descent direction.
+///
+enum class newton_type : uint8_t
+{
+    ldlt, ///< solve the Newton system with the LDLT decomposition of the dense Hessian: O(n^3)
+    cg,   ///< solve inexactly the Newton system with conjugate gradients using Hessian-vector products - see (1)
+};
+
+template <>
+inline enum_map_t<newton_type> enum_string()
+{
+    return {
+        {newton_type::ldlt, "ldlt"},
+        {  newton_type::cg,   "cg"}
+    };
+}
+
 ///
 /// \brief (truncated) newton method with line-search.
 ///
+/// see (1) "Numerical optimization", Nocedal & Wright, 2nd edition - ch. 7.1 (line-search Newton-CG)
+///
 /// NB: the functional constraints (if any) are all ignored.
+/// NB: the Newton-CG variant is matrix-free (no O(n^2) memory) if the function implements efficiently
+///     the Hessian-vector products (e.g. linear models).
 ///
 class NANO_PUBLIC solver_newton_t final : public solver_t
 {
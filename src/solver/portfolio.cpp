@@ -0,0 +1,169 @@
+#include <nano/core/parallel.h>
+#include <nano/core/sampling.h>
+#include <nano/core/tokenizer.h>
+#include <nano/critical.h>
+#include <solver/portfolio.h>
+
+using namespace nano;
+
+namespace
+{
+auto converged(const solver_status status)
+{
+    return status == solver_status::value_test || status == solver_status::gradient_test ||
+           status == solver_status::specific_test || status == solver_status::kkt_optimality_test;
+}
+
+struct candidate_t
+{
+    candidate_t(rsolver_t solver, rfunction_t function, vector_t x0)
+        : m_solver(std::move(solver))
+        , m_function(std::move(function))
+        , m_x(std::move(x0))
+    {
+    }
+
+    void minimize(const tensor_size_t max_evals)
+    {
+        m_solver->parameter("solver::max_evals") = max_evals;
+
+        const auto state = m_solver->minimize(*m_function, m_x, make_null_logger());
+
+        m_x      = state.x();
+        m_fx     = state.fx();
+        m_status = state.status();
+        m_fcalls += state.fcalls();
+        m_gcalls += state.gcalls();
+        m_hcalls += state.hcalls();
+    }
+
+    tensor_size_t evals() const { return m_fcalls + m_gcalls; }
+
+    bool operator<(const candidate_t& other) const
+    {
+        // NB: the candidates with invalid function values are the worst!
+        return std::isfinite(m_fx) && (!std::isfinite(other.m_fx) || m_fx < other.m_fx);
+    }
+
+    // attributes
+    rsolver_t     m_solver;                           ///< solver to run
+    rfunction_t   m_function;                         ///< copy of the function to minimize
+    vector_t      m_x;                                ///< current point
+    scalar_t      m_fx{0.0};                          ///< current function value
+    solver_status m_status{solver_status::max_iters}; ///< status of the last run
+    tensor_size_t m_fcalls{0};                        ///< number of function value evaluations so far
+    tensor_size_t m_gcalls{0};                        ///< number of function gradient evaluations so far
+    tensor_size_t m_hcalls{0};                        ///< number of function hessian evaluations so far
+};
+
+using candidates_t = std::vector<candidate_t>;
+} // namespace
+
+solver_portfolio_t::solver_portfolio_t()
+    : solver_t("portfolio")
+{
+    register_parameter(parameter_t::make_string("solver::portfolio::solvers", "lbfgs,cgd-pr,rqb"));
+    register_parameter(parameter_t::make_integer("solver::portfolio::starts", 1, LE, 1, LE, 1000));
+    register_parameter(parameter_t::make_scalar("solver::portfolio::radius", 0.0, LT, 1.0, LE, 1e+6));
+    register_parameter(parameter_t::make_scalar("solver::portfolio::racing", 0.0, LT, 0.5, LT, 1.0));
+    register_parameter(parameter_t::make_integer("solver::portfolio::seed", 0, LE, 42, LE, 1024));
+}
+
+rsolver_t solver_portfolio_t::clone() const
+{
+    return std::make_unique<solver_portfolio_t>(*this);
+}
+
+solver_state_t solver_portfolio_t::do_minimize(const function_t& function, const vector_t& x0,
+                                               const logger_t& logger) const
+{
+    const auto max_evals  = parameter("solver::max_evals").value<tensor_size_t>();
+    const auto solver_ids = parameter("solver::portfolio::solvers").value<string_t>();
+    const auto starts     = parameter("solver::portfolio::starts").value<tensor_size_t>();
+    const auto radius     = parameter("solver::portfolio::radius").value<scalar_t>();
+    const auto racing     = parameter("solver::portfolio::racing").value<scalar_t>();
+    const auto seed       = parameter("solver::portfolio::seed").value<uint64_t>();
+
+    // setup the starting points
+    auto rng = make_rng(seed);
+    auto x0s = std::vector<vector_t>{};
+    x0s.push_back(x0);
+    for (tensor_size_t start = 1; start < starts; ++start)
+    {
+        x0s.push_back(sample_from_ball(x0, radius, rng));
+    }
+
+    // setup the candidates: all combinations of solvers and starting points
+    auto candidates = candidates_t{};
+    for (auto tokenizer = tokenizer_t{solver_ids, ",;| "}; tokenizer; ++tokenizer)
+    {
+        const auto solver_id = string_t{tokenizer.get()};
+
+        auto solver = solver_t::all().get(solver_id);
+        critical(solver != nullptr && solver_id != type_id(), scat("[solver-", type_id(), "]: invalid solver id <",
+                                                                   solver_id, ">!"));
+
+        solver->parameter("solver::epsilon")   = parameter("solver::epsilon").value<scalar_t>();
+        solver->parameter("solver::patience")  = parameter("solver::patience").value<tensor_size_t>();
+        solver->parameter("solver::tolerance") = parameter("solver::tolerance").value_pair<scalar_t>();
+
+        for (const auto& x : x0s)
+        {
+            candidates.emplace_back(solver->clone(), function.clone(), x);
+        }
+    }
+    critical(!candidates.empty(), scat("[solver-", type_id(), "]: no solver given!"));
+
+    // race the candidates with successive halving
+    auto       alive       = candidates.size();
+    const auto rounds      = static_cast<tensor_size_t>(std::ceil(std::log2(static_cast<scalar_t>(alive))));
+    const auto round_evals = static_cast<tensor_size_t>(racing * static_cast<scalar_t>(max_evals)) /
+                             std::max(rounds, tensor_size_t{1});
+
+    for (tensor_size_t round = 0; alive > 1; ++round)
+    {
+        const auto evals = std::max(round_evals / static_cast<tensor_size_t>(alive), tensor_size_t{10});
+
+        // NB: the function calls of a copy are not thread-safe, so run sequentially if not reentrant!
+        if (function.reentrant())
+        {
+            parallel::scheduler_t::shared().map(alive, [&](const size_t i, size_t) { candidates[i].minimize(evals); });
+        }
+        else
+        {
+            for (size_t i = 0; i < alive; ++i)
+            {
+                candidates[i].minimize(evals);
+            }
+        }
+
+        std::stable_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(alive));
+
+        const auto& best = candidates[0];
+        logger.info("round=", round + 1, "/", rounds, ",candidates=", alive, ",best=", best.m_solver->type_id(),
+                    ",fx=", best.m_fx, ",status=", best.m_status, ".\n");
+
+        // NB: stop racing if the best candidate has already converged!
+        alive = converged(best.m_status) ? 1U : (alive + 1) / 2;
+    }
+
+    // continue with the best candidate until the budget is exhausted
+    auto used_evals = tensor_size_t{0};
+    for (const auto& candidate : candidates)
+    {
+        used_evals += candidate.evals();
+    }
+
+    const auto& best = candidates[0];
+    best.m_solver->parameter("solver::max_evals") = std::max(max_evals - used_evals, tensor_size_t{10});
+
+    auto state = best.m_solver->minimize(function, best.m_x, logger);
+
+    for (const auto& candidate : candidates)
+    {
+        function.add_statistics(candidate.m_fcalls, candidate.m_gcalls, candidate.m_hcalls);
+    }
+    state.update_calls();
+
+    return state;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <nano/solver.h>
+
+namespace nano
+{
+///
+/// \brief portfolio of solvers and starting points raced concurrently with successive halving.
+///
+/// see "Non-stochastic best arm identification and hyperparameter optimization", by Jamieson, Talwalkar, 2016
+///
+/// NB: each candidate (solver, starting point) is run for a fraction of the budget starting from where it stopped
+///     in the previous round and then the worse half of the candidates (in terms of function value) is discarded.
+///     The racing stops early if the best candidate has converged.
+///
+/// NB: the remaining budget is spent by the best candidate starting from the best point found so far.
+///
+/// NB: the starting points are the given initial point and points sampled (reproducibly) uniformly
+///     from the ball of the given radius centered at the initial point.
+///
+/// NB: the candidates are run in parallel on copies of the function if the function is reentrant,
+///     otherwise sequentially. In both cases the function calls are registered to the given function.
+///
+class NANO_PUBLIC solver_portfolio_t final : public solver_t
+{
+public:
+    ///
+    /// \brief default constructor
+    ///
+    solver_portfolio_t();
+
+    ///
+    /// \brief @see clonable_t
+    ///
+    rsolver_t clone() const override;
+
+    ///
+    /// \brief @see solver_t
+    ///
+    solver_state_t do_minimize(const function_t&, const vector_t& x0, const logger_t&) const override;
+};
+} // namespace nano
@@ -83,6 +83,7 @@ solver_quasi_t::solver_quasi_t(string_t id)
     parameter("solver::tolerance") = std::make_tuple(1e-4, 9e-1);
 
     register_parameter(parameter_t::make_enum("solver::quasi::initialization", quasi_initialization::identity));
+    register_parameter(parameter_t::make_integer("solver::quasi::history", 0, LE, 0, LE, 1000));
 }
 
 bool solver_quasi_t::has_lsearch() const
@@ -97,6 +98,7 @@ solver_state_t solver_quasi_t::do_minimize(const function_t& function, const vec
 
     const auto max_evals = parameter("solver::max_evals").value<tensor_size_t>();
     const auto init      = parameter("solver::quasi::initialization").value<quasi_initialization>();
+    const auto history   = parameter("solver::quasi::history").value<tensor_size_t>();
 
     auto cstate = solver_state_t{function, x0}; // current state
     if (cstate.gx().lpNorm<Eigen::Infinity>() < epsilon0<scalar_t>())
@@ -105,25 +107,56 @@ solver_state_t solver_quasi_t::do_minimize(const function_t& function, const vec
         return cstate;
     }
 
-    auto pstate  = cstate;     // previous state
-    auto descent = vector_t{}; // descent direction
+    auto pstate  = cstate;                     // previous state
+    auto descent = vector_t{function.size()}; // descent direction
     auto lsearch = make_lsearch();
 
-    // current approximation of the Hessian's inverse
-    matrix_t H = matrix_t::identity(function.size(), function.size());
+    // current approximation of the Hessian's inverse:
+    //  - either dense O(n^2) or
+    //  - compact O(n * history) if requested and supported by the update formula
+    auto H = matrix_t{};
+    auto C = std::optional<quasi_compact_t>{};
+    if (const auto formula = this->formula(); history > 0 && formula.has_value())
+    {
+        C.emplace(formula.value(), function.size(), history);
+    }
+    else
+    {
+        H = matrix_t::identity(function.size(), function.size());
+    }
+
+    const auto reset = [&](const scalar_t gamma)
+    {
+        if (C)
+        {
+            C->reset(gamma);
+        }
+        else
+        {
+            H = matrix_t::identity(H.rows(), H.cols()) * gamma;
+        }
+    };
 
     bool first_iteration = true;
     while (function.fcalls() + function.gcalls() < max_evals)
     {
         // descent direction
-        descent = -H.matrix() * cstate.gx().vector();
+        if (C)
+        {
+            C->apply(cstate.gx(), descent);
+            descent = -descent;
+        }
+        else
+        {
+            descent = -H.matrix() * cstate.gx().vector();
+        }
 
         // restart:
         //  - if not a descent direction
         if (!cstate.has_descent(descent))
         {
             descent = -cstate.gx();
-            H       = matrix_t::identity(H.rows(), H.cols());
+            reset(1.0);
         }
 
         // line-search
@@ -139,12 +172,19 @@ solver_state_t solver_quasi_t::do_minimize(const function_t& function, const vec
         {
             const auto dx = cstate.x() - pstate.x();
             const auto dg = cstate.gx() - pstate.gx();
-            H             = matrix_t::identity(H.rows(), H.cols()) * dx.dot(dg) / dg.dot(dg);
+            reset(dx.dot(dg) / dg.dot(dg));
         }
         first_iteration = false;
 
         // update approximation of the Hessian
-        update(pstate, cstate, H);
+        if (C)
+        {
+            update_compact(pstate, cstate, *C);
+        }
+        else
+        {
+            update(pstate, cstate, H);
+        }
     }
 
     return choose(cstate, pstate);
@@ -176,6 +216,16 @@ solver_quasi_sr1_t::solver_quasi_sr1_t()
     register_parameter(parameter_t::make_scalar("solver::quasi::sr1::r", 0, LT, 1e-8, LT, 1));
 }
 
+bool solver_quasi_t::update_compact(const solver_state_t& prev, const solver_state_t& curr, quasi_compact_t& H) const
+{
+    return H.update(curr.x() - prev.x(), curr.gx() - prev.gx());
+}
+
+std::optional<quasi_formula> solver_quasi_t::formula() const
+{
+    return std::nullopt;
+}
+
 rsolver_t solver_quasi_dfp_t::clone() const
 {
     return std::make_unique<solver_quasi_dfp_t>(*this);
@@ -227,3 +277,26 @@ void solver_quasi_fletcher_t::update(const solver_state_t& prev, const solver_st
 {
     ::FLETCHER(H, curr.x() - prev.x(), curr.gx() - prev.gx());
 }
+
+bool solver_quasi_sr1_t::update_compact(const solver_state_t& prev, const solver_state_t& curr,
+                                        quasi_compact_t& H) const
+{
+    const auto r = parameter("solver::quasi::sr1::r").value<scalar_t>();
+
+    return H.update(curr.x() - prev.x(), curr.gx() - prev.gx(), r);
+}
+
+std::optional<quasi_formula> solver_quasi_sr1_t::formula() const
+{
+    return quasi_formula::sr1;
+}
+
+std::optional<quasi_formula> solver_quasi_dfp_t::formula() const
+{
+    return quasi_formula::dfp;
+}
+
+std::optional<quasi_formula> solver_quasi_bfgs_t::formula() const
+{
+    return quasi_formula::bfgs;
+}
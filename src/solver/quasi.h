@@ -1,6 +1,7 @@
 #pragma once
 
 #include <nano/solver.h>
+#include <solver/quasi/compact.h>
 
 namespace nano
 {
@@ -30,6 +31,10 @@ inline enum_map_t<quasi_initialization> enum_string()
 /// see (3) "Introductory Lectures on Convex Optimization (Applied Optimization)", Nesterov, 2013
 /// see (4) "A new approach to variable metric algorithms", Fletcher, 1972
 ///
+/// NB: the approximation of the Hessian's inverse is stored either as a dense n x n matrix (by default) or
+///     using a compact limited-memory representation of the last `solver::quasi::history` updates.
+///     the latter is supported only by SR1, DFP and BFGS and it scales to large problems: O(n * history) per update.
+///
 class NANO_PUBLIC solver_quasi_t : public solver_t
 {
 public:
@@ -50,6 +55,10 @@ public:
 
 private:
     virtual void update(const solver_state_t& prev, const solver_state_t& curr, matrix_t& H) const = 0;
+
+    virtual bool update_compact(const solver_state_t& prev, const solver_state_t& curr, quasi_compact_t& H) const;
+
+    virtual std::optional<quasi_formula> formula() const;
 };
 
 ///
@@ -74,6 +83,16 @@ public:
     /// \brief @see solver_quasi_t
     ///
     void update(const solver_state_t&, const solver_state_t&, matrix_t&) const override;
+
+    ///
+    /// \brief @see solver_quasi_t
+    ///
+    bool update_compact(const solver_state_t&, const solver_state_t&, quasi_compact_t&) const override;
+
+    ///
+    /// \brief @see solver_quasi_t
+    ///
+    std::optional<quasi_formula> formula() const override;
 };
 
 ///
@@ -98,6 +117,11 @@ public:
     /// \brief @see solver_quasi_t
     ///
     void update(const solver_state_t&, const solver_state_t&, matrix_t&) const override;
+
+    ///
+    /// \brief @see solver_quasi_t
+    ///
+    std::optional<quasi_formula> formula() const override;
 };
 
 ///
@@ -122,6 +146,11 @@ public:
     /// \brief @see solver_quasi_t
     ///
     void update(const solver_state_t&, const solver_state_t&, matrix_t&) const override;
+
+    ///
+    /// \brief @see solver_quasi_t
+    ///
+    std::optional<quasi_formula> formula() const override;
 };
 
 ///
@@ -0,0 +1,164 @@
+#include <Eigen/Dense>
+#include <nano/core/numeric.h>
+#include <solver/quasi/compact.h>
+
+using namespace nano;
+
+quasi_compact_t::quasi_compact_t(const quasi_formula formula, const tensor_size_t size, const tensor_size_t history)
+    : m_formula(formula)
+    , m_S(history, size)
+    , m_Y(history, size)
+    , m_SY(history, history)
+    , m_YY(history, history)
+{
+    assert(size > 0);
+    assert(history > 0);
+}
+
+void quasi_compact_t::reset(const scalar_t gamma)
+{
+    m_gamma = gamma;
+    m_pairs = 0;
+}
+
+bool quasi_compact_t::update(const vector_t& dx, const vector_t& dg, const scalar_t sr1_r)
+{
+    assert(dx.size() == m_S.cols());
+    assert(dg.size() == m_S.cols());
+
+    if (m_formula == quasi_formula::sr1)
+    {
+        // NB: skip the update if the denominator is too small, see (2), p. 145.
+        auto Hdg = vector_t{dg.size()};
+        apply(dg, Hdg);
+
+        const auto dz = dx.vector() - Hdg.vector();
+        if (!(std::fabs(dz.dot(dg.vector())) >= sr1_r * dz.lpNorm<2>() * dg.lpNorm<2>()))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        // NB: skip the update if the curvature condition doesn't hold as the compact representation is not defined.
+        const auto dxdg = dx.dot(dg);
+        if (!std::isfinite(dxdg) || dxdg <= epsilon0<scalar_t>() * dx.lpNorm<2>() * dg.lpNorm<2>())
+        {
+            return false;
+        }
+    }
+
+    push(dx, dg);
+    return true;
+}
+
+void quasi_compact_t::push(const vector_t& dx, const vector_t& dg)
+{
+    const auto history = m_S.rows();
+
+    if (m_pairs == history)
+    {
+        // discard the oldest pair
+        for (tensor_size_t i = 1; i < history; ++i)
+        {
+            m_S.matrix().row(i - 1) = m_S.matrix().row(i);
+            m_Y.matrix().row(i - 1) = m_Y.matrix().row(i);
+        }
+        m_SY.matrix().topLeftCorner(history - 1, history - 1) =
+            m_SY.matrix().bottomRightCorner(history - 1, history - 1).eval();
+        m_YY.matrix().topLeftCorner(history - 1, history - 1) =
+            m_YY.matrix().bottomRightCorner(history - 1, history - 1).eval();
+
+        --m_pairs;
+    }
+
+    const auto k = m_pairs++;
+
+    m_S.matrix().row(k) = dx.vector().transpose();
+    m_Y.matrix().row(k) = dg.vector().transpose();
+
+    const auto S = m_S.matrix().topRows(k + 1);
+    const auto Y = m_Y.matrix().topRows(k + 1);
+
+    // NB: update only the last row and column of the dot products, O(n * history).
+    m_SY.matrix().row(k).head(k + 1) = (Y * dx.vector()).transpose();
+    m_SY.matrix().col(k).head(k + 1) = S * dg.vector();
+    m_YY.matrix().row(k).head(k + 1) = (Y * dg.vector()).transpose();
+    m_YY.matrix().col(k).head(k + 1) = m_YY.matrix().row(k).head(k + 1).transpose();
+}
+
+void quasi_compact_t::apply(const vector_t& g, vector_t& Hg) const
+{
+    assert(g.size() == m_S.cols());
+    assert(Hg.size() == m_S.cols());
+
+    const auto k = m_pairs;
+
+    Hg.vector() = m_gamma * g.vector();
+    if (k == 0)
+    {
+        return;
+    }
+
+    const auto S  = m_S.matrix().topRows(k);
+    const auto Y  = m_Y.matrix().topRows(k);
+    const auto SY = m_SY.matrix().topLeftCorner(k, k);
+    const auto YY = m_YY.matrix().topLeftCorner(k, k);
+
+    const eigen_vector_t<scalar_t> Sg = S * g.vector();
+    const eigen_vector_t<scalar_t> Yg = Y * g.vector();
+
+    switch (m_formula)
+    {
+    case quasi_formula::bfgs:
+    {
+        // H = H0 + [S H0*Y] * |R^-T * (D + Y^T * H0 * Y) * R^-1    -R^-T| * |S^T     |, see (1)
+        //                     |-R^-1                               0   |   |Y^T * H0|
+        //  where R is the upper triangular part of S^T * Y and D its diagonal.
+        const auto R = SY.triangularView<Eigen::Upper>();
+
+        const eigen_vector_t<scalar_t> t = R.solve(Sg);
+        const eigen_vector_t<scalar_t> z = SY.diagonal().cwiseProduct(t) + m_gamma * (YY * t - Yg);
+        const eigen_vector_t<scalar_t> a = R.transpose().solve(z);
+
+        Hg.vector() += S.transpose() * a - m_gamma * (Y.transpose() * t);
+        break;
+    }
+
+    case quasi_formula::sr1:
+    {
+        // H = H0 + (S - H0 * Y) * (D + U + U^T - Y^T * H0 * Y)^-1 * (S - H0 * Y)^T, see (1)
+        //  where U is the strictly upper triangular part of S^T * Y and D its diagonal.
+        eigen_matrix_t<scalar_t> M = SY.triangularView<Eigen::StrictlyUpper>();
+        M                          = (M + M.transpose()).eval();
+        M.diagonal() += SY.diagonal();
+        M -= m_gamma * YY;
+
+        const eigen_vector_t<scalar_t> c = M.fullPivLu().solve(Sg - m_gamma * Yg);
+
+        Hg.vector() += S.transpose() * c - m_gamma * (Y.transpose() * c);
+        break;
+    }
+
+    case quasi_formula::dfp:
+    {
+        // H = H0 - [H0 * Y  S] * |Y^T * H0 * Y   L|^-1 * |Y^T * H0|, see (1) - the dual of the direct BFGS formula
+        //                        |L^T           -D|      |S^T     |
+        //  where L is the strictly lower triangular part of Y^T * S and D its diagonal.
+        eigen_matrix_t<scalar_t> N{2 * k, 2 * k};
+        N.topLeftCorner(k, k)     = m_gamma * YY;
+        N.topRightCorner(k, k)    = SY.transpose().triangularView<Eigen::StrictlyLower>();
+        N.bottomLeftCorner(k, k)  = N.topRightCorner(k, k).transpose();
+        N.bottomRightCorner(k, k) = (-SY.diagonal()).asDiagonal();
+
+        eigen_vector_t<scalar_t> p{2 * k};
+        p.head(k) = m_gamma * Yg;
+        p.tail(k) = Sg;
+
+        const eigen_vector_t<scalar_t> c = N.fullPivLu().solve(p);
+
+        Hg.vector() -= m_gamma * (Y.transpose() * c.head(k)) + S.transpose() * c.tail(k);
+        break;
+    }
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <nano/tensor.h>
+
+namespace nano
+{
+///
+/// \brief quasi-Newton formulas that admit a compact (low-rank) representation of the Hessian's inverse.
+///
+enum class quasi_formula : uint8_t
+{
+    sr1,  ///< symmetric rank one
+    dfp,  ///< Davidon-Fletcher-Powell
+    bfgs, ///< Broyden-Fletcher-Goldfarb-Shanno
+};
+
+///
+/// \brief limited-memory compact representation of the quasi-Newton approximation of the Hessian's inverse:
+///     H = gamma * I + low-rank correction built from the last `history` pairs (s_i = dx_i, y_i = dg_i).
+///
+/// see (1) "Representations of quasi-Newton matrices and their use in limited memory methods",
+///     by R. Byrd, J. Nocedal, R. Schnabel, 1994
+/// see (2) "Numerical optimization", Nocedal & Wright, 2nd edition - ch. 7.2
+///
+/// NB: the pairs are stored as rows of (history x n) matrices together with the small matrices of dot products
+///     S^T * Y and Y^T * Y, so that an update costs O(n * history) and
+///     a product with the Hessian's inverse costs O(n * history + history^3) without forming any n x n matrix.
+///
+/// NB: the oldest pair is discarded when the history is full.
+///
+class NANO_PUBLIC quasi_compact_t
+{
+public:
+    ///
+    /// \brief constructor
+    ///
+    quasi_compact_t(quasi_formula, tensor_size_t size, tensor_size_t history);
+
+    ///
+    /// \brief discard all pairs and set the initial approximation to H0 = gamma * I.
+    ///
+    void reset(scalar_t gamma = 1.0);
+
+    ///
+    /// \brief add the given pair (dx, dg) to the representation.
+    ///
+    /// NB: returns false if the pair is skipped because the update is not well-defined (numerically).
+    ///
+    bool update(const vector_t& dx, const vector_t& dg, scalar_t sr1_r = 1e-8);
+
+    ///
+    /// \brief compute the product H * g.
+    ///
+    void apply(const vector_t& g, vector_t& Hg) const;
+
+    ///
+    /// \brief returns the number of stored pairs.
+    ///
+    tensor_size_t pairs() const { return m_pairs; }
+
+private:
+    void push(const vector_t& dx, const vector_t& dg);
+
+    // attributes
+    quasi_formula m_formula{quasi_formula::bfgs}; ///<
+    scalar_t      m_gamma{1.0};                   ///< initial approximation H0 = gamma * I
+    tensor_size_t m_pairs{0};                     ///< number of stored pairs
+    matrix_t      m_S;                            ///< variations of the solution (one per row)
+    matrix_t      m_Y;                            ///< variations of the gradient (one per row)
+    matrix_t      m_SY;                           ///< S^T * Y (for the stored pairs)
+    matrix_t      m_YY;                           ///< Y^T * Y (for the stored pairs)
+};
+} // namespace nano
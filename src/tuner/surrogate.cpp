@@ -17,6 +17,7 @@ quadratic_surrogate_fit_t::quadratic_surrogate_fit_t(const loss_t& loss, tensor2
 {
     convex(loss.convex() ? convexity::yes : convexity::no);
     smooth(loss.smooth() ? smoothness::yes : smoothness::no);
+    reentrant(false);
 
     assert(m_p2.size<0>() == m_y.size<0>());
 
@@ -51,20 +52,20 @@ scalar_t quadratic_surrogate_fit_t::do_eval(eval_t eval) const
     const auto samples = m_p2.size<0>();
     const auto targets = m_y.reshape(samples, 1, 1, 1);
 
+    m_loss.eval(targets, m_loss_outputs, m_loss_values, eval.has_grad() ? &m_loss_grads : nullptr,
+                eval.has_hess() ? &m_loss_hesss : nullptr);
+
     if (eval.has_grad())
     {
-        m_loss.vgrad(targets, m_loss_outputs, m_loss_grads);
         eval.m_gx = m_p2.matrix().transpose() * m_loss_grads.vector();
     }
 
     if (eval.has_hess())
     {
-        m_loss.vhess(targets, m_loss_outputs, m_loss_hesss);
         const auto inputs            = m_p2.matrix();
         eval.m_hx.matrix().noalias() = (inputs.array().colwise() * m_loss_hesss.array()).matrix().transpose() * inputs;
     }
 
-    m_loss.value(targets, m_loss_outputs, m_loss_values);
     return m_loss_values.sum();
 }
 
@@ -32,6 +32,32 @@ void wlearner::accumulator_t::clear(const tensor_size_t bins)
     clear();
 }
 
+void wlearner::accumulator_t::update(const accumulator_t& other, const tensor_size_t other_bin,
+                                     const tensor_size_t bin)
+{
+    assert(tdims() == other.tdims());
+
+    x0(bin) += other.x0(other_bin);
+    x1(bin) += other.x1(other_bin);
+    x2(bin) += other.x2(other_bin);
+    r1(bin) += other.r1(other_bin);
+    rx(bin) += other.rx(other_bin);
+    r2(bin) += other.r2(other_bin);
+}
+
+void wlearner::accumulator_t::subtract(const accumulator_t& other)
+{
+    assert(bins() == other.bins());
+    assert(tdims() == other.tdims());
+
+    m_x0.array() -= other.m_x0.array();
+    m_x1.array() -= other.m_x1.array();
+    m_x2.array() -= other.m_x2.array();
+    m_r1.array() -= other.m_r1.array();
+    m_rx.array() -= other.m_rx.array();
+    m_r2.array() -= other.m_r2.array();
+}
+
 std::vector<std::pair<scalar_t, tensor_size_t>> wlearner::accumulator_t::sort() const
 {
     const auto bins = this->bins();
@@ -3,11 +3,13 @@
 #include <nano/tensor/stream.h>
 #include <nano/wlearner/criterion.h>
 #include <nano/wlearner/dtree.h>
+#include <nano/wlearner/histogram.h>
 #include <nano/wlearner/stump.h>
 #include <nano/wlearner/util.h>
 #include <set>
 
 using namespace nano;
+using namespace nano::wlearner;
 
 namespace
 {
@@ -28,6 +30,101 @@ public:
     size_t        m_parent{0}; ///<
 };
 
+class hnode_t
+{
+public:
+    hnode_t(indices_t samples, const tensor_size_t depth, const size_t parent, const tensor_size_t features,
+            const tensor3d_dims_t& tdims)
+        : m_samples(std::move(samples))
+        , m_depth(depth)
+        , m_parent(parent)
+        , m_histograms(static_cast<size_t>(features), histogram_t{tdims})
+        , m_scores(features)
+        , m_bins(features)
+        , m_tables(cat_dims(features, cat_dims(2, tdims)))
+    {
+    }
+
+    void fit(const tensor_size_t ifeature, const wlearner_criterion criterion)
+    {
+        auto& histogram         = m_histograms[static_cast<size_t>(ifeature)];
+        const auto [score, bin] = histogram.fit(criterion);
+
+        m_scores(ifeature) = score;
+        m_bins(ifeature)   = bin;
+        if (score != wlearner_t::no_fit_score())
+        {
+            m_tables.tensor(ifeature) = histogram.tables();
+        }
+    }
+
+    // attributes
+    indices_t     m_samples;    ///<
+    tensor_size_t m_depth{0};   ///<
+    size_t        m_parent{0};  ///<
+    histograms_t  m_histograms; ///< (#quantized features) - per-bin statistics of the samples
+    tensor1d_t    m_scores;     ///< (#quantized features) - score of the best split per feature
+    indices_t     m_bins;       ///< (#quantized features) - bin of the best split per feature
+    tensor5d_t    m_tables;     ///< (#quantized features, 2, #outputs) - tables of the best split per feature
+};
+
+class hsplit_t
+{
+public:
+    hsplit_t(histograms_t histograms, indices_t dropped, const size_t child)
+        : m_histograms(std::move(histograms))
+        , m_dropped(std::move(dropped))
+        , m_child(child)
+    {
+    }
+
+    // attributes
+    histograms_t m_histograms; ///< (#quantized features) - per-bin statistics of the parent node
+    indices_t    m_dropped;    ///< samples of the parent node with missing values for the splitting feature
+    size_t       m_child{0};   ///< index of the first child node (the second one follows)
+};
+
+auto partition(const indices_t& samples, const histogram_t::codes_cmap_t& codes, const tensor_size_t bin)
+{
+    tensor_size_t count_neg = 0, count_pos = 0, count_missing = 0;
+    for (const auto sample : samples)
+    {
+        const auto code = codes(sample);
+        if (code == quantized_features_t::missing_bin)
+        {
+            ++count_missing;
+        }
+        else
+        {
+            ++(static_cast<tensor_size_t>(code) <= bin ? count_neg : count_pos);
+        }
+    }
+
+    auto samples_neg     = indices_t{count_neg};
+    auto samples_pos     = indices_t{count_pos};
+    auto samples_missing = indices_t{count_missing};
+
+    count_neg = count_pos = count_missing = 0;
+    for (const auto sample : samples)
+    {
+        const auto code = codes(sample);
+        if (code == quantized_features_t::missing_bin)
+        {
+            samples_missing(count_missing++) = sample;
+        }
+        else if (static_cast<tensor_size_t>(code) <= bin)
+        {
+            samples_neg(count_neg++) = sample;
+        }
+        else
+        {
+            samples_pos(count_pos++) = sample;
+        }
+    }
+
+    return std::make_tuple(std::move(samples_neg), std::move(samples_pos), std::move(samples_missing));
+}
+
 void append(tensor4d_t& tables, const tensor3d_cmap_t& table)
 {
     // NB: This conservative resize is not very efficient!
@@ -107,6 +204,7 @@ dtree_wlearner_t::dtree_wlearner_t()
 {
     register_parameter(parameter_t::make_integer("wlearner::dtree::max_depth", 1, LE, 3, LE, 10));
     register_parameter(parameter_t::make_integer("wlearner::dtree::min_split", 1, LE, 5, LE, 10));
+    register_parameter(parameter_t::make_integer("wlearner::bins", 0, LE, 0, LE, quantized_features_t::max_bins));
 }
 
 std::istream& dtree_wlearner_t::read(std::istream& stream)
@@ -144,6 +242,7 @@ scalar_t dtree_wlearner_t::do_fit(const dataset_t& dataset, const indices_t& sam
     const auto max_depth = parameter("wlearner::dtree::max_depth").value<tensor_size_t>();
     const auto min_split = parameter("wlearner::dtree::min_split").value<tensor_size_t>();
     const auto criterion = parameter("wlearner::criterion").value<wlearner_criterion>();
+    const auto bins      = parameter("wlearner::bins").value<tensor_size_t>();
 
     const auto min_samples_size = std::min<tensor_size_t>(10, dataset.samples() * min_split / 100);
 
@@ -152,71 +251,219 @@ scalar_t dtree_wlearner_t::do_fit(const dataset_t& dataset, const indices_t& sam
     auto stump  = stump_wlearner_t{};
     auto tables = tensor4d_t{cat_dims(0, dataset.target_dims())};
 
-    stump.parameter("wlearner::criterion") = criterion;
-
-    std::deque<cache_t> caches;
-    caches.emplace_back(samples);
-    while (!caches.empty())
+    if (bins > 0)
     {
-        const auto cache = caches.front();
-
-        // split the node using decision stumps...
-        log_info('[', type_id(), "]: ", std::fixed, std::setprecision(8), " +++ depth=", cache.m_depth,
-                 ",samples=", cache.m_samples.size(),
-                 ",score=", score == wlearner_t::no_fit_score() ? scat("N/A") : scat(score), "...\n");
-        const auto score_stump = stump.fit(dataset, cache.m_samples, gradients);
-        if (score_stump == wlearner_t::no_fit_score())
+        // quantized mode: grow the tree level-wise using histograms...
+        const auto& quantized = dataset.quantize(bins);
+        const auto& qfeatures = quantized.features();
+        const auto  nfeatures = qfeatures.size();
+        const auto  tdims     = dataset.target_dims();
+
+        auto buffers = histograms_t(dataset.concurrency(), histogram_t{tdims});
+        auto splits  = std::vector<hsplit_t>{};
+        auto hnodes  = std::vector<hnode_t>{};
+        hnodes.emplace_back(samples, 0, std::numeric_limits<size_t>::max(), nfeatures, tdims);
+
+        while (!hnodes.empty() && score != wlearner_t::no_fit_score())
         {
-            score = wlearner_t::no_fit_score();
-            break;
-        }
+            // ... fit all nodes at the current depth in parallel (for all features)
+            //  where only the smallest child is scanned and the other's histogram is obtained by subtraction
+            const auto jobs = splits.empty() ? static_cast<tensor_size_t>(hnodes.size())
+                                             : static_cast<tensor_size_t>(splits.size());
+
+            dataset.thread_pool().map(
+                jobs * nfeatures,
+                [&](const tensor_size_t index, const size_t tnum)
+                {
+                    const auto ijob     = static_cast<size_t>(index / nfeatures);
+                    const auto ifeature = index % nfeatures;
+                    const auto findex   = static_cast<size_t>(ifeature);
+                    const auto feature  = qfeatures(ifeature);
+                    const auto fbins    = quantized.bins(feature);
+                    const auto codes    = quantized.codes(feature);
+
+                    if (splits.empty())
+                    {
+                        auto& hnode     = hnodes[ijob];
+                        auto& histogram = hnode.m_histograms[findex];
+                        histogram.clear(fbins);
+                        histogram.update(gradients, codes, hnode.m_samples);
+                        hnode.fit(ifeature, criterion);
+                        return;
+                    }
+
+                    auto& split  = splits[ijob];
+                    auto& hnode0 = hnodes[split.m_child + 0U];
+                    auto& hnode1 = hnodes[split.m_child + 1U];
+
+                    auto& hsmall = hnode0.m_samples.size() <= hnode1.m_samples.size() ? hnode0 : hnode1;
+                    auto& hlarge = hnode0.m_samples.size() <= hnode1.m_samples.size() ? hnode1 : hnode0;
+
+                    auto& histogram_small = hsmall.m_histograms[findex];
+                    auto& histogram_large = hlarge.m_histograms[findex];
+
+                    histogram_small.clear(fbins);
+                    histogram_small.update(gradients, codes, hsmall.m_samples);
+
+                    if (hlarge.m_samples.size() <= hsmall.m_samples.size() + split.m_dropped.size())
+                    {
+                        histogram_large.clear(fbins);
+                        histogram_large.update(gradients, codes, hlarge.m_samples);
+                    }
+                    else
+                    {
+                        histogram_large = std::move(split.m_histograms[findex]);
+                        histogram_large.subtract(histogram_small);
+                        if (split.m_dropped.size() > 0)
+                        {
+                            auto& histogram_dropped = buffers[tnum];
+                            histogram_dropped.clear(fbins);
+                            histogram_dropped.update(gradients, codes, split.m_dropped);
+                            histogram_large.subtract(histogram_dropped);
+                        }
+                    }
+
+                    hsmall.fit(ifeature, criterion);
+                    hlarge.fit(ifeature, criterion);
+                });
+
+            // ... and choose the best split for each node in the breadth-first order
+            auto nsplits = std::vector<hsplit_t>{};
+            auto nhnodes = std::vector<hnode_t>{};
+            for (auto& hnode : hnodes)
+            {
+                log_info('[', type_id(), "]: ", std::fixed, std::setprecision(8), " +++ depth=", hnode.m_depth,
+                         ",samples=", hnode.m_samples.size(),
+                         ",score=", score == wlearner_t::no_fit_score() ? scat("N/A") : scat(score), "...\n");
 
-        dtree_node_t node;
-        node.m_feature   = stump.feature();
-        node.m_threshold = stump.threshold();
+                const auto* const it       = std::min_element(hnode.m_scores.begin(), hnode.m_scores.end());
+                const auto        ifeature = static_cast<tensor_size_t>(it - hnode.m_scores.begin());
 
-        const auto& tables_stump = stump.tables();
-        const auto  cluster      = stump.split(dataset, cache.m_samples);
-        assert(cluster.groups() == tables_stump.size<0>());
+                const auto score_stump = nfeatures > 0 ? *it : wlearner_t::no_fit_score();
+                if (score_stump == wlearner_t::no_fit_score())
+                {
+                    score = wlearner_t::no_fit_score();
+                    break;
+                }
 
-        // have the parent node point to the current terminal node (to be added)
-        if (cache.m_parent < nodes.size())
-        {
-            nodes[cache.m_parent].m_next = nodes.size();
+                const auto feature = qfeatures(ifeature);
+                const auto bin     = hnode.m_bins(ifeature);
+
+                dtree_node_t node;
+                node.m_feature   = feature;
+                node.m_threshold = quantized.thresholds(feature)(bin);
+
+                const auto tables_stump = hnode.m_tables.tensor(ifeature);
+
+                // have the parent node point to the current terminal node (to be added)
+                if (hnode.m_parent < nodes.size())
+                {
+                    nodes[hnode.m_parent].m_next = nodes.size();
+                }
+
+                // terminal nodes...
+                if (hnode.m_samples.size() < min_samples_size || (hnode.m_depth + 1) >= max_depth)
+                {
+                    for (tensor_size_t i = 0, size = tables_stump.size<0>(); i < size; ++i)
+                    {
+                        node.m_table = tables.size<0>();
+                        nodes.emplace_back(node);
+                        append(tables, tables_stump.tensor(i));
+                    }
+
+                    // also, update the total score
+                    score += score_stump;
+                }
+
+                // can still split the samples
+                else
+                {
+                    auto [samples_neg, samples_pos, samples_missing] =
+                        ::partition(hnode.m_samples, quantized.codes(feature), bin);
+
+                    nsplits.emplace_back(std::move(hnode.m_histograms), std::move(samples_missing), nhnodes.size());
+
+                    node.m_table = -1;
+                    nhnodes.emplace_back(std::move(samples_neg), hnode.m_depth + 1, nodes.size(), nfeatures, tdims);
+                    nodes.push_back(node);
+                    nhnodes.emplace_back(std::move(samples_pos), hnode.m_depth + 1, nodes.size(), nfeatures, tdims);
+                    nodes.push_back(node);
+                }
+            }
+
+            splits = std::move(nsplits);
+            hnodes = std::move(nhnodes);
         }
+    }
+    else
+    {
+        // exact mode: grow the tree breadth-first by fitting decision stumps...
+        stump.parameter("wlearner::criterion") = criterion;
 
-        // terminal nodes...
-        if (cache.m_samples.size() < min_samples_size || (cache.m_depth + 1) >= max_depth)
+        std::deque<cache_t> caches;
+        caches.emplace_back(samples);
+        while (!caches.empty())
         {
-            for (tensor_size_t i = 0, size = tables_stump.size<0>(); i < size; ++i)
+            const auto cache = caches.front();
+
+            // split the node using decision stumps...
+            log_info('[', type_id(), "]: ", std::fixed, std::setprecision(8), " +++ depth=", cache.m_depth,
+                     ",samples=", cache.m_samples.size(),
+                     ",score=", score == wlearner_t::no_fit_score() ? scat("N/A") : scat(score), "...\n");
+            const auto score_stump = stump.fit(dataset, cache.m_samples, gradients);
+            if (score_stump == wlearner_t::no_fit_score())
             {
-                node.m_table = tables.size<0>();
-                nodes.emplace_back(node);
-                append(tables, tables_stump.tensor(i));
+                score = wlearner_t::no_fit_score();
+                break;
             }
 
-            // also, update the total score
-            score += score_stump;
-        }
+            dtree_node_t node;
+            node.m_feature   = stump.feature();
+            node.m_threshold = stump.threshold();
 
-        // can still split the samples
-        else
-        {
-            cache_t ncache;
-            ncache.m_depth = cache.m_depth + 1;
+            const auto& tables_stump = stump.tables();
+            const auto  cluster      = stump.split(dataset, cache.m_samples);
+            assert(cluster.groups() == tables_stump.size<0>());
 
-            for (tensor_size_t i = 0, size = tables_stump.size<0>(); i < size; ++i)
+            // have the parent node point to the current terminal node (to be added)
+            if (cache.m_parent < nodes.size())
             {
-                ncache.m_parent  = nodes.size();
-                ncache.m_samples = cluster.indices(i);
+                nodes[cache.m_parent].m_next = nodes.size();
+            }
 
-                node.m_table = -1;
-                nodes.push_back(node);
-                caches.push_back(ncache);
+            // terminal nodes...
+            if (cache.m_samples.size() < min_samples_size || (cache.m_depth + 1) >= max_depth)
+            {
+                for (tensor_size_t i = 0, size = tables_stump.size<0>(); i < size; ++i)
+                {
+                    node.m_table = tables.size<0>();
+                    nodes.emplace_back(node);
+                    append(tables, tables_stump.tensor(i));
+                }
+
+                // also, update the total score
+                score += score_stump;
             }
-        }
 
-        caches.pop_front();
+            // can still split the samples
+            else
+            {
+                cache_t ncache;
+                ncache.m_depth = cache.m_depth + 1;
+
+                for (tensor_size_t i = 0, size = tables_stump.size<0>(); i < size; ++i)
+                {
+                    ncache.m_parent  = nodes.size();
+                    ncache.m_samples = cluster.indices(i);
+
+                    node.m_table = -1;
+                    nodes.push_back(node);
+                    caches.push_back(ncache);
+                }
+            }
+
+            caches.pop_front();
+        }
     }
 
     // OK, compact the selected features
@@ -35,6 +35,7 @@ public:
         : m_beta0(tdims)
         , m_acc_sum(tdims)
         , m_acc_neg(tdims)
+        , m_acc_bin(tdims)
         , m_tables(cat_dims(2, tdims))
     {
         m_beta0.zero();
@@ -92,6 +93,37 @@ public:
         return std::make_tuple(missing_rss, missing_cnt);
     }
 
+    auto clear(const tensor4d_t& gradients, const scalar_cmap_t& values, const indices_t& samples,
+               const quantized_features_t::codes_cmap_t& codes, const tensor_size_t bins)
+    {
+        m_acc_sum.clear();
+        m_acc_neg.clear();
+        m_acc_bin.clear(bins);
+
+        auto missing_rss = 0.0;
+        auto missing_cnt = 0.0;
+
+        for (tensor_size_t i = 0; i < values.size(); ++i)
+        {
+            if (const auto code = codes(samples(i)); code != quantized_features_t::missing_bin)
+            {
+                m_acc_bin.update(values(i), gradients.array(samples(i)), static_cast<tensor_size_t>(code));
+            }
+            else
+            {
+                missing_rss += gradients.array(samples(i)).square().sum();
+                missing_cnt += 1.0;
+            }
+        }
+
+        for (tensor_size_t bin = 0; bin < bins; ++bin)
+        {
+            m_acc_sum.update(m_acc_bin, bin);
+        }
+
+        return std::make_tuple(missing_rss, missing_cnt);
+    }
+
     auto beta0() const { return m_beta0.array(); }
 
     auto beta_neg(const scalar_t threshold) const
@@ -142,6 +174,7 @@ public:
     ivalues_t     m_ivalues;                           ///<
     tensor3d_t    m_beta0;                             ///<
     accumulator_t m_acc_sum, m_acc_neg;                ///<
+    accumulator_t m_acc_bin;                           ///< per-bin statistics (if quantized)
     tensor4d_t    m_tables;                            ///<
     tensor_size_t m_feature{-1};                       ///<
     scalar_t      m_threshold{0};                      ///<
@@ -153,6 +186,7 @@ public:
 hinge_wlearner_t::hinge_wlearner_t()
     : single_feature_wlearner_t("hinge")
 {
+    register_parameter(parameter_t::make_integer("wlearner::bins", 0, LE, 0, LE, quantized_features_t::max_bins));
 }
 
 std::istream& hinge_wlearner_t::read(std::istream& stream)
@@ -183,49 +217,79 @@ rwlearner_t hinge_wlearner_t::clone() const
 scalar_t hinge_wlearner_t::do_fit(const dataset_t& dataset, const indices_t& samples, const tensor4d_t& gradients)
 {
     const auto criterion = parameter("wlearner::criterion").value<wlearner_criterion>();
+    const auto bins      = parameter("wlearner::bins").value<tensor_size_t>();
     const auto iterator  = select_iterator_t{dataset};
 
+    const auto* const quantized = bins > 0 ? &dataset.quantize(bins) : nullptr;
+
     std::vector<cache_t> caches(iterator.concurrency(), cache_t{dataset.target_dims()});
     iterator.loop(samples,
                   [&](const tensor_size_t feature, const size_t tnum, scalar_cmap_t fvalues)
                   {
-                      // update accumulators
-                      auto& cache                           = caches[tnum];
-                      const auto [missing_rss, missing_cnt] = cache.clear(gradients, fvalues, samples);
-                      for (size_t iv = 0, sv = cache.m_ivalues.size(); iv + 1 < sv; ++iv)
+                      auto& cache = caches[tnum];
+
+                      // try the given threshold for both hinge types
+                      const auto update = [&](const scalar_t threshold, const scalar_t missing_rss,
+                                              const scalar_t missing_cnt)
                       {
-                          const auto& ivalue1 = cache.m_ivalues[iv + 0];
-                          const auto& ivalue2 = cache.m_ivalues[iv + 1];
+                          // ... try the left hinge
+                          const auto score_neg = cache.score_neg(threshold, criterion, missing_rss, missing_cnt);
+                          if (std::isfinite(score_neg) && score_neg < cache.m_score)
+                          {
+                              cache.m_score           = score_neg;
+                              cache.m_feature         = feature;
+                              cache.m_hinge           = hinge_type::left;
+                              cache.m_threshold       = threshold;
+                              cache.m_tables.array(0) = cache.beta_neg(threshold);
+                              cache.m_tables.array(1) = -threshold * cache.m_tables.array(0);
+                          }
 
-                          cache.m_acc_neg.update(ivalue1.first, gradients.array(ivalue1.second));
+                          // ... try the right hinge
+                          const auto score_pos = cache.score_pos(threshold, criterion, missing_rss, missing_cnt);
+                          if (std::isfinite(score_pos) && score_pos < cache.m_score)
+                          {
+                              cache.m_score           = score_pos;
+                              cache.m_feature         = feature;
+                              cache.m_hinge           = hinge_type::right;
+                              cache.m_threshold       = threshold;
+                              cache.m_tables.array(0) = cache.beta_pos(threshold);
+                              cache.m_tables.array(1) = -threshold * cache.m_tables.array(0);
+                          }
+                      };
 
-                          if (ivalue1.first < ivalue2.first)
+                      if (quantized != nullptr && quantized->quantized(feature))
+                      {
+                          // quantized mode: scan the per-bin statistics
+                          const auto thresholds = quantized->thresholds(feature);
+                          const auto fbins      = quantized->bins(feature);
+                          const auto codes      = quantized->codes(feature);
+
+                          const auto [missing_rss, missing_cnt] =
+                              cache.clear(gradients, fvalues, samples, codes, fbins);
+                          for (tensor_size_t bin = 0; bin + 1 < fbins; ++bin)
                           {
-                              // update the parameters if a better feature
-                              const auto threshold = 0.5 * (ivalue1.first + ivalue2.first);
+                              cache.m_acc_neg.update(cache.m_acc_bin, bin);
 
-                              // ... try the left hinge
-                              const auto score_neg = cache.score_neg(threshold, criterion, missing_rss, missing_cnt);
-                              if (std::isfinite(score_neg) && score_neg < cache.m_score)
+                              if (cache.m_acc_bin.x0(bin) > 0.0 && cache.x0_neg() > 0.0 && cache.x0_pos() > 0.0)
                               {
-                                  cache.m_score           = score_neg;
-                                  cache.m_feature         = feature;
-                                  cache.m_hinge           = hinge_type::left;
-                                  cache.m_threshold       = threshold;
-                                  cache.m_tables.array(0) = cache.beta_neg(threshold);
-                                  cache.m_tables.array(1) = -threshold * cache.m_tables.array(0);
+                                  update(thresholds(bin), missing_rss, missing_cnt);
                               }
+                          }
+                      }
+                      else
+                      {
+                          // exact mode: sort the feature values
+                          const auto [missing_rss, missing_cnt] = cache.clear(gradients, fvalues, samples);
+                          for (size_t iv = 0, sv = cache.m_ivalues.size(); iv + 1 < sv; ++iv)
+                          {
+                              const auto& ivalue1 = cache.m_ivalues[iv + 0];
+                              const auto& ivalue2 = cache.m_ivalues[iv + 1];
+
+                              cache.m_acc_neg.update(ivalue1.first, gradients.array(ivalue1.second));
 
-                              // ... try the right hinge
-                              const auto score_pos = cache.score_pos(threshold, criterion, missing_rss, missing_cnt);
-                              if (std::isfinite(score_pos) && score_pos < cache.m_score)
+                              if (ivalue1.first < ivalue2.first)
                               {
-                                  cache.m_score           = score_pos;
-                                  cache.m_feature         = feature;
-                                  cache.m_hinge           = hinge_type::right;
-                                  cache.m_threshold       = threshold;
-                                  cache.m_tables.array(0) = cache.beta_pos(threshold);
-                                  cache.m_tables.array(1) = -threshold * cache.m_tables.array(0);
+                                  update(0.5 * (ivalue1.first + ivalue2.first), missing_rss, missing_cnt);
                               }
                           }
                       }
@@ -0,0 +1,101 @@
+#include <nano/wlearner.h>
+#include <nano/wlearner/histogram.h>
+
+using namespace nano;
+using namespace nano::wlearner;
+
+namespace
+{
+template <class tarray, class toutputs>
+auto score(const scalar_t r0, const tarray& r1, const tarray& r2, const toutputs& outputs)
+{
+    return (r2 + outputs.square() * r0 - 2 * outputs * r1).sum();
+}
+} // namespace
+
+histogram_t::histogram_t(const tensor3d_dims_t& tdims)
+    : m_acc_bin(tdims)
+    , m_acc_sum(tdims)
+    , m_acc_neg(tdims)
+    , m_tables(cat_dims(2, tdims))
+{
+    m_tables.zero();
+}
+
+void histogram_t::clear(const tensor_size_t bins)
+{
+    m_acc_bin.clear(bins);
+    m_missing_rss = 0.0;
+    m_missing_cnt = 0.0;
+}
+
+void histogram_t::update(const tensor4d_t& gradients, const codes_cmap_t codes, const indices_t& samples)
+{
+    for (tensor_size_t i = 0; i < samples.size(); ++i)
+    {
+        const auto sample = samples(i);
+        if (const auto code = codes(sample); code != quantized_features_t::missing_bin)
+        {
+            m_acc_bin.update(gradients.array(sample), static_cast<tensor_size_t>(code));
+        }
+        else
+        {
+            m_missing_rss += gradients.array(sample).square().sum();
+            m_missing_cnt += 1.0;
+        }
+    }
+}
+
+void histogram_t::subtract(const histogram_t& other)
+{
+    m_acc_bin.subtract(other.m_acc_bin);
+    m_missing_rss -= other.m_missing_rss;
+    m_missing_cnt -= other.m_missing_cnt;
+}
+
+std::tuple<scalar_t, tensor_size_t> histogram_t::fit(const wlearner_criterion criterion)
+{
+    const auto bins = this->bins();
+
+    m_acc_sum.clear();
+    m_acc_neg.clear();
+    for (tensor_size_t bin = 0; bin < bins; ++bin)
+    {
+        m_acc_sum.update(m_acc_bin, bin);
+    }
+
+    const auto k = 2 * ::nano::size(m_acc_sum.tdims()) + 1;
+    const auto n = static_cast<tensor_size_t>(m_acc_sum.x0() + m_missing_cnt);
+
+    auto best_score = wlearner_t::no_fit_score();
+    auto best_bin   = tensor_size_t{-1};
+    for (tensor_size_t bin = 0; bin + 1 < bins; ++bin)
+    {
+        m_acc_neg.update(m_acc_bin, bin);
+
+        const auto x0_neg = m_acc_neg.x0();
+        const auto x0_pos = m_acc_sum.x0() - x0_neg;
+        if (m_acc_bin.x0(bin) > 0.0 && x0_neg > 0.0 && x0_pos > 0.0)
+        {
+            const auto r1_neg = m_acc_neg.r1();
+            const auto r2_neg = m_acc_neg.r2();
+            const auto r1_pos = m_acc_sum.r1() - m_acc_neg.r1();
+            const auto r2_pos = m_acc_sum.r2() - m_acc_neg.r2();
+
+            const auto rss = ::score(x0_neg, r1_neg, r2_neg, r1_neg / x0_neg) +
+                             ::score(x0_pos, r1_pos, r2_pos, r1_pos / x0_pos) + m_missing_rss;
+
+            // update the parameters if a better split
+            const auto score = make_score(criterion, rss, k, n);
+            if (std::isfinite(score) && score < best_score)
+            {
+                best_score        = score;
+                best_bin          = bin;
+                m_tables.array(0) = r1_neg / x0_neg;
+                m_tables.array(1) = r1_pos / x0_pos;
+            }
+        }
+    }
+
+    return std::make_tuple(best_score, best_bin);
+}
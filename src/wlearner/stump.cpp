@@ -3,6 +3,7 @@
 #include <nano/core/stream.h>
 #include <nano/wlearner/accumulator.h>
 #include <nano/wlearner/criterion.h>
+#include <nano/wlearner/histogram.h>
 #include <nano/wlearner/stump.h>
 #include <nano/wlearner/util.h>
 
@@ -23,6 +24,7 @@ public:
     explicit cache_t(const tensor3d_dims_t& tdims = tensor3d_dims_t{0, 0, 0})
         : m_acc_sum(tdims)
         , m_acc_neg(tdims)
+        , m_histogram(tdims)
         , m_tables(cat_dims(2, tdims))
     {
     }
@@ -87,6 +89,7 @@ public:
     ivalues_t     m_ivalues;                           ///<
     accumulator_t m_acc_sum;                           ///<
     accumulator_t m_acc_neg;                           ///<
+    histogram_t   m_histogram;                         ///< per-bin statistics (if quantized)
     tensor4d_t    m_tables;                            ///<
     tensor_size_t m_feature{-1};                       ///<
     scalar_t      m_threshold{0};                      ///<
@@ -97,6 +100,7 @@ public:
 stump_wlearner_t::stump_wlearner_t()
     : single_feature_wlearner_t("stump")
 {
+    register_parameter(parameter_t::make_integer("wlearner::bins", 0, LE, 0, LE, quantized_features_t::max_bins));
 }
 
 std::istream& stump_wlearner_t::read(std::istream& stream)
@@ -125,37 +129,70 @@ rwlearner_t stump_wlearner_t::clone() const
 scalar_t stump_wlearner_t::do_fit(const dataset_t& dataset, const indices_t& samples, const tensor4d_t& gradients)
 {
     const auto criterion = parameter("wlearner::criterion").value<wlearner_criterion>();
+    const auto bins      = parameter("wlearner::bins").value<tensor_size_t>();
     const auto iterator  = select_iterator_t{dataset};
 
     std::vector<cache_t> caches(iterator.concurrency(), cache_t{dataset.target_dims()});
-    iterator.loop(samples,
-                  [&](const tensor_size_t feature, const size_t tnum, scalar_cmap_t fvalues)
-                  {
-                      // update accumulators
-                      auto& cache                           = caches[tnum];
-                      const auto [missing_rss, missing_cnt] = cache.clear(gradients, fvalues, samples);
-                      for (size_t iv = 0, sv = cache.m_ivalues.size(); iv + 1 < sv; ++iv)
+    if (bins > 0)
+    {
+        // quantized mode: scan the per-bin statistics of each feature
+        const auto& quantized = dataset.quantize(bins);
+        const auto& features  = quantized.features();
+
+        dataset.thread_pool().map(
+            features.size(),
+            [&](const tensor_size_t index, const size_t tnum)
+            {
+                const auto feature = features(index);
+
+                // update accumulators
+                auto& cache = caches[tnum];
+                cache.m_histogram.clear(quantized.bins(feature));
+                cache.m_histogram.update(gradients, quantized.codes(feature), samples);
+
+                // update the parameters if a better feature
+                const auto [score, bin] = cache.m_histogram.fit(criterion);
+                if (score < cache.m_score)
+                {
+                    cache.m_score     = score;
+                    cache.m_feature   = feature;
+                    cache.m_threshold = quantized.thresholds(feature)(bin);
+                    cache.m_tables    = cache.m_histogram.tables();
+                }
+            });
+    }
+    else
+    {
+        // exact mode: sort the feature values of each feature
+        iterator.loop(samples,
+                      [&](const tensor_size_t feature, const size_t tnum, scalar_cmap_t fvalues)
                       {
-                          const auto& ivalue1 = cache.m_ivalues[iv + 0];
-                          const auto& ivalue2 = cache.m_ivalues[iv + 1];
+                          // update accumulators
+                          auto& cache                           = caches[tnum];
+                          const auto [missing_rss, missing_cnt] = cache.clear(gradients, fvalues, samples);
+                          for (size_t iv = 0, sv = cache.m_ivalues.size(); iv + 1 < sv; ++iv)
+                          {
+                              const auto& ivalue1 = cache.m_ivalues[iv + 0];
+                              const auto& ivalue2 = cache.m_ivalues[iv + 1];
 
-                          cache.m_acc_neg.update(gradients.array(ivalue1.second));
+                              cache.m_acc_neg.update(gradients.array(ivalue1.second));
 
-                          if (ivalue1.first < ivalue2.first)
-                          {
-                              // update the parameters if a better feature
-                              const auto score = cache.score(criterion, missing_rss, missing_cnt);
-                              if (std::isfinite(score) && score < cache.m_score)
+                              if (ivalue1.first < ivalue2.first)
                               {
-                                  cache.m_score           = score;
-                                  cache.m_feature         = feature;
-                                  cache.m_threshold       = 0.5 * (ivalue1.first + ivalue2.first);
-                                  cache.m_tables.array(0) = cache.output_neg();
-                                  cache.m_tables.array(1) = cache.output_pos();
+                                  // update the parameters if a better feature
+                                  const auto score = cache.score(criterion, missing_rss, missing_cnt);
+                                  if (std::isfinite(score) && score < cache.m_score)
+                                  {
+                                      cache.m_score           = score;
+                                      cache.m_feature         = feature;
+                                      cache.m_threshold       = 0.5 * (ivalue1.first + ivalue2.first);
+                                      cache.m_tables.array(0) = cache.output_neg();
+                                      cache.m_tables.array(1) = cache.output_pos();
+                                  }
                               }
                           }
-                      }
-                  });
+                      });
+    }
 
     // OK, return and store the optimum feature across threads
     const auto& best = min_reduce(caches);
@@ -65,6 +65,25 @@ struct function_config_t
         // check (sub-)gradient approximation with centering difference
         UTEST_CHECK_LESS(grad_accuracy(*rfunction, x, config.m_grad_accuracy_epsilon), config.m_grad_accuracy_epsilon);
 
+        // check multi-point evaluation is equivalent to evaluating each point independently
+        {
+            auto xs      = matrix_t{3, rfunction->size()};
+            xs.tensor(0) = x;
+            xs.tensor(1) = z;
+            xs.tensor(2) = 0.5 * (x + z);
+
+            auto fxs = make_random_vector<scalar_t>(xs.rows());
+            auto gxs = make_random_matrix<scalar_t>(xs.rows(), xs.cols());
+            rfunction->evaluate(xs, fxs, gxs);
+
+            auto gx = make_random_vector<scalar_t>(xs.cols());
+            for (tensor_size_t k = 0; k < xs.rows(); ++k)
+            {
+                UTEST_CHECK_CLOSE(fxs(k), (*rfunction)(xs.tensor(k), gx), epsilon1<scalar_t>());
+                UTEST_CHECK_CLOSE(gxs.tensor(k), gx, epsilon1<scalar_t>());
+            }
+        }
+
         // check Hessian approximation with centering difference
         if (rfunction->smooth())
         {
@@ -78,6 +97,11 @@ struct function_config_t
             auto H = make_random_matrix<scalar_t>(function.size(), function.size());
             (*rfunction)(x, {}, H);
             UTEST_CHECK(H.matrix().isApprox(H.transpose()));
+
+            // check Hessian-vector product
+            auto Hz = make_random_vector<scalar_t>(function.size());
+            rfunction->hessian_vector(x, z, Hz);
+            UTEST_CHECK_CLOSE(Hz, vector_t{H.matrix() * z.vector()}, epsilon1<scalar_t>());
         }
     }
 }
@@ -27,6 +27,62 @@ static auto make_wlearners()
     return wlearners;
 }
 
+static auto make_rows(const dataset_t& dataset, const indices_t& samples)
+{
+    auto rows = tensor2d_t{samples.size(), dataset.features()};
+    rows.full(std::numeric_limits<scalar_t>::quiet_NaN());
+
+    auto sbuffer = sclass_mem_t{};
+    auto fbuffer = scalar_mem_t{};
+    for (tensor_size_t feature = 0; feature < dataset.features(); ++feature)
+    {
+        if (dataset.feature(feature).is_sclass())
+        {
+            const auto values = dataset.select(samples, feature, sbuffer);
+            for (tensor_size_t i = 0; i < samples.size(); ++i)
+            {
+                rows(i, feature) = values(i) >= 0 ? static_cast<scalar_t>(values(i)) : rows(i, feature);
+            }
+        }
+        else if (dataset.feature(feature).is_scalar())
+        {
+            rows.matrix().col(feature) = dataset.select(samples, feature, fbuffer).vector();
+        }
+    }
+    return rows;
+}
+
+static void check_compiled(const gboost_model_t& model, const dataset_t& dataset, const indices_t& samples)
+{
+    const auto& compiled = model.compiled();
+    UTEST_CHECK_EQUAL(static_cast<size_t>(compiled.roots() + compiled.lookups()) + compiled.fallbacks().size(),
+                      model.wlearners().size());
+
+    // the compiled model should be equivalent to cumulating the predictions of each weak learner
+    const auto outputs = model.predict(dataset, samples);
+
+    auto expected_outputs = tensor4d_t{outputs.dims()};
+    expected_outputs.reshape(samples.size(), -1).matrix().rowwise() = model.bias().vector().transpose();
+    for (const auto& wlearner : model.wlearners())
+    {
+        wlearner->predict(dataset, samples, expected_outputs.tensor());
+    }
+    UTEST_CHECK_CLOSE(outputs, expected_outputs, 1e-12);
+
+    // the rows of feature values can be scored directly if all weak learners are lowered
+    auto       scores = tensor4d_t{outputs.dims()};
+    const auto rows   = make_rows(dataset, samples);
+    if (compiled.fallbacks().empty())
+    {
+        UTEST_REQUIRE_NOTHROW(model.score(rows, scores.tensor()));
+        UTEST_CHECK_CLOSE(scores, outputs, 1e-12);
+    }
+    else
+    {
+        UTEST_CHECK_THROW(model.score(rows, scores.tensor()), std::runtime_error);
+    }
+}
+
 static void check_predict(const gboost_model_t& model, const dataset_t& dataset, const scalar_t epsilon = 1e-12)
 {
     const auto samples  = arange(0, dataset.samples());
@@ -35,6 +91,8 @@ static void check_predict(const gboost_model_t& model, const dataset_t& dataset,
 
     iterator.loop([&](const tensor_range_t& range, size_t, tensor4d_cmap_t targets)
                   { UTEST_CHECK_CLOSE(targets, outputs.slice(range), epsilon); });
+
+    check_compiled(model, dataset, samples);
 }
 
 static void check_predict_throws(const gboost_model_t& model)
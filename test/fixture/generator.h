@@ -177,10 +177,13 @@ template <template <class, size_t> class tstorage, class tscalar, size_t trank>
                 if (batch == 2)
                 {
                     UTEST_CHECK(!iterator.cache_flatten(0U));
+                    UTEST_CHECK_EQUAL(iterator.cache_sparse(0U), iterator.sparse());
                 }
                 else
                 {
                     UTEST_CHECK(iterator.cache_flatten(1U << 24));
+                    UTEST_CHECK(iterator.cache_sparse(1U << 24));
+                    UTEST_CHECK(iterator.sparse());
                 }
 
                 const auto& stats                   = iterator.flatten_stats();
@@ -202,6 +205,22 @@ template <template <class, size_t> class tstorage, class tscalar, size_t trank>
                         }));
                     UTEST_CHECK_EQUAL(called, make_full_tensor<tensor_size_t>(make_dims(samples.size()), 1));
                 }
+                {
+                    // NB: the hybrid dense-sparse representation should give the same feature values
+                    auto called = make_full_tensor<tensor_size_t>(make_dims(samples.size()), 0);
+                    UTEST_CHECK_NOTHROW(iterator.loop(
+                        [&](const tensor_range_t range, const size_t, const sparse_flatten_t& flatten)
+                        {
+                            called.slice(range).full(1);
+                            UTEST_REQUIRE_EQUAL(flatten.samples(), range.size());
+                            UTEST_REQUIRE_EQUAL(flatten.columns(), dataset.columns());
+
+                            auto dense = tensor2d_t{range.size(), dataset.columns()};
+                            flatten.densify(dense.tensor());
+                            UTEST_REQUIRE_CLOSE(dense, expected_scaled_flatten.indexed(samples.slice(range)), eps);
+                        }));
+                    UTEST_CHECK_EQUAL(called, make_full_tensor<tensor_size_t>(make_dims(samples.size()), 1));
+                }
                 if (!dropped)
                 {
                     // NB: also test with shuffling the columns associated to the first feature
@@ -119,6 +119,26 @@ template <class tweights, class tbias>
     UTEST_CHECK_EQUAL(model.weights().dims(), make_dims(1, dataset.columns()));
     UTEST_CHECK_EQUAL(model.bias().dims(), make_dims(1));
 
+    // the predictions should be the same when scoring directly the flatten feature values
+    {
+        auto       buffer = tensor2d_t{};
+        const auto rows   = dataset.flatten(samples, buffer);
+
+        auto scores = tensor4d_t{outputs.dims()};
+        UTEST_REQUIRE_NOTHROW(model.score(rows, scores.tensor()));
+        UTEST_CHECK_CLOSE(scores, outputs, 1e-12);
+
+        scores.zero();
+        for (tensor_size_t i = 0; i < samples.size(); ++i)
+        {
+            UTEST_REQUIRE_NOTHROW(model.score(rows.slice(i, i + 1), scores.slice(i, i + 1)));
+        }
+        UTEST_CHECK_CLOSE(scores, outputs, 1e-12);
+
+        const auto invalid_rows = map_tensor(rows.data(), rows.size(), 1);
+        UTEST_CHECK_THROW(model.score(invalid_rows, scores.tensor()), std::runtime_error);
+    }
+
     string_t str;
     {
         std::ostringstream stream;
@@ -0,0 +1,123 @@
+#include <fixture/dataset.h>
+#include <fixture/datasource/hits.h>
+#include <fixture/datasource/random.h>
+#include <nano/dataset/iterator.h>
+#include <nano/dataset/quantize.h>
+
+using namespace nano;
+
+namespace
+{
+auto make_features()
+{
+    return features_t{
+        feature_t{"sclass0"}.sclass(strings_t{"s10", "s11"}),
+        feature_t{"scalar0"}.scalar(feature_type::float64),
+        feature_t{"scalar1"}.scalar(feature_type::int8),
+        feature_t{"struct0"}.scalar(feature_type::float32, make_dims(1, 2, 2)),
+        feature_t{"target"}.scalar(feature_type::float64),
+    };
+}
+
+auto make_datasource(const tensor_size_t samples)
+{
+    const auto features = make_features();
+    const auto target   = features.size() - 1U;
+    const auto hits     = make_random_hits(samples, static_cast<tensor_size_t>(features.size()), target);
+
+    auto datasource = random_datasource_t{samples, features, target, hits};
+    UTEST_REQUIRE_NOTHROW(datasource.load());
+    return datasource;
+}
+
+void check_quantized(const dataset_t& dataset, const quantized_features_t& quantized, const tensor_size_t bins)
+{
+    UTEST_CHECK_EQUAL(quantized.bins(), bins);
+    UTEST_CHECK_EQUAL(quantized.features(), make_scalar_features(dataset));
+
+    for (tensor_size_t feature = 0; feature < dataset.features(); ++feature)
+    {
+        UTEST_CHECK_EQUAL(quantized.quantized(feature), dataset.feature(feature).is_scalar());
+    }
+
+    const auto samples = arange(0, dataset.samples());
+    for (const auto feature : quantized.features())
+    {
+        UTEST_REQUIRE(quantized.quantized(feature));
+
+        const auto fbins      = quantized.bins(feature);
+        const auto codes      = quantized.codes(feature);
+        const auto thresholds = quantized.thresholds(feature);
+
+        UTEST_CHECK_GREATER(fbins, 1);
+        UTEST_CHECK_LESS_EQUAL(fbins, bins);
+        UTEST_REQUIRE_EQUAL(thresholds.size(), fbins - 1);
+        UTEST_REQUIRE_EQUAL(codes.size(), dataset.samples());
+        for (tensor_size_t bin = 1; bin < thresholds.size(); ++bin)
+        {
+            UTEST_CHECK_LESS(thresholds(bin - 1), thresholds(bin));
+        }
+
+        auto buffer = scalar_mem_t{};
+        auto counts = indices_t{fbins};
+        counts.zero();
+
+        const auto values = dataset.select(samples, feature, buffer);
+        for (tensor_size_t sample = 0; sample < dataset.samples(); ++sample)
+        {
+            const auto value = values(sample);
+            const auto code  = static_cast<tensor_size_t>(codes(sample));
+            if (!std::isfinite(value))
+            {
+                UTEST_CHECK_EQUAL(codes(sample), quantized_features_t::missing_bin);
+            }
+            else
+            {
+                UTEST_REQUIRE_LESS(code, fbins);
+                UTEST_CHECK(code == 0 || thresholds(code - 1) <= value);
+                UTEST_CHECK(code + 1 == fbins || value < thresholds(code));
+                ++counts(code);
+            }
+        }
+
+        UTEST_CHECK_GREATER(counts.min(), 0);
+    }
+}
+} // namespace
+
+UTEST_BEGIN_MODULE()
+
+UTEST_CASE(quantize)
+{
+    const auto datasource = make_datasource(500);
+    const auto dataset    = make_dataset(datasource);
+
+    for (const tensor_size_t bins : {2, 8, 16, 64, 255})
+    {
+        const auto& quantized = dataset.quantize(bins);
+        check_quantized(dataset, quantized, bins);
+
+        // NB: the quantization is cached!
+        UTEST_CHECK_EQUAL(&quantized, &dataset.quantize(bins));
+    }
+}
+
+UTEST_CASE(quantize_distinct)
+{
+    const auto datasource = make_datasource(500);
+    const auto dataset    = make_dataset(datasource);
+
+    // NB: the integer feature values take few distinct values, so each value should have its own bin!
+    const auto& quantized = dataset.quantize(64);
+
+    const auto feature    = tensor_size_t{2};
+    const auto thresholds = quantized.thresholds(feature);
+    UTEST_REQUIRE(quantized.quantized(feature));
+    UTEST_CHECK_EQUAL(quantized.bins(feature), 17 + 11 + 1);
+    for (tensor_size_t bin = 0; bin < thresholds.size(); ++bin)
+    {
+        UTEST_CHECK_CLOSE(thresholds(bin), -11.0 + static_cast<scalar_t>(bin) + 0.5, 1e-12);
+    }
+}
+
+UTEST_END_MODULE()
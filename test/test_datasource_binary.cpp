@@ -0,0 +1,144 @@
+#include <filesystem>
+#include <fixture/datasource.h>
+#include <fixture/datasource/hits.h>
+#include <fixture/datasource/random.h>
+#include <fstream>
+#include <nano/datasource/binary.h>
+
+using namespace nano;
+
+namespace
+{
+auto make_features()
+{
+    return features_t{
+        feature_t{"i8"}.scalar(feature_type::int8),
+        feature_t{"i16"}.scalar(feature_type::int16),
+        feature_t{"i32"}.scalar(feature_type::int32),
+        feature_t{"i64"}.scalar(feature_type::int64),
+        feature_t{"f32"}.scalar(feature_type::float32),
+        feature_t{"f64"}.scalar(feature_type::float64),
+
+        feature_t{"ui8_struct"}.scalar(feature_type::uint8, make_dims(2, 1, 2)),
+        feature_t{"ui16_struct"}.scalar(feature_type::uint16, make_dims(1, 1, 1)),
+        feature_t{"ui32_struct"}.scalar(feature_type::uint32, make_dims(1, 2, 1)),
+        feature_t{"ui64_struct"}.scalar(feature_type::uint64, make_dims(1, 1, 2)),
+        feature_t{"f64_struct"}.scalar(feature_type::float64, make_dims(3, 1, 1)),
+
+        feature_t{"mclass3"}.mclass(3),
+        feature_t{"sclass2"}.sclass(strings_t{"cate0", "cate1"}),
+        feature_t{"sclass10"}.sclass(10),
+    };
+}
+
+auto make_path()
+{
+    return (std::filesystem::temp_directory_path() / "test_datasource_binary.bin").string();
+}
+
+auto make_random_datasource(const size_t target, const tensor_size_t samples = 101)
+{
+    const auto features = make_features();
+    const auto hits     = make_random_hits(samples, static_cast<tensor_size_t>(features.size()), target);
+
+    auto datasource = random_datasource_t{samples, features, target, hits};
+    UTEST_REQUIRE_NOTHROW(datasource.load());
+    return datasource;
+}
+
+void check_equal(const datasource_t& datasource, const datasource_t& expected)
+{
+    UTEST_REQUIRE_EQUAL(datasource.type(), expected.type());
+    UTEST_REQUIRE_EQUAL(datasource.samples(), expected.samples());
+    UTEST_REQUIRE_EQUAL(datasource.features(), expected.features());
+    UTEST_CHECK_EQUAL(datasource.train_samples(), expected.train_samples());
+    UTEST_CHECK_EQUAL(datasource.test_samples(), expected.test_samples());
+
+    const auto check_feature = [&](const auto& visit)
+    {
+        visit(expected,
+              [&](const feature_t& gt_feature, const auto& gt_data, const auto& gt_mask)
+              {
+                  visit(datasource,
+                        [&](const feature_t& feature, const auto& data, const auto& mask)
+                        {
+                            UTEST_CHECK_EQUAL(feature, gt_feature);
+                            UTEST_CHECK_EQUAL(mask, gt_mask);
+                            if constexpr (std::is_same_v<decltype(data), decltype(gt_data)>)
+                            {
+                                UTEST_CHECK_EQUAL(data, gt_data);
+                            }
+                            else
+                            {
+                                UTEST_CHECK(false);
+                            }
+                        });
+              });
+    };
+
+    for (tensor_size_t feature = 0; feature < expected.features(); ++feature)
+    {
+        check_feature([&](const datasource_t& source, const auto& op) { source.visit_inputs(feature, op); });
+    }
+    if (expected.type() != task_type::unsupervised)
+    {
+        check_feature([&](const datasource_t& source, const auto& op) { source.visit_target(op); });
+    }
+}
+} // namespace
+
+UTEST_BEGIN_MODULE()
+
+UTEST_CASE(cannot_load_no_file)
+{
+    auto datasource = binary_datasource_t{"binary", make_path() + ".missing"};
+    UTEST_CHECK_THROW(datasource.load(), std::runtime_error);
+}
+
+UTEST_CASE(cannot_load_invalid_file)
+{
+    const auto path = make_path();
+    {
+        auto stream = std::ofstream{path, std::ios::binary | std::ios::trunc};
+        stream << "this is not a binary columnar dataset!";
+    }
+
+    auto datasource = binary_datasource_t{"binary", path};
+    UTEST_CHECK_THROW(datasource.load(), std::runtime_error);
+
+    std::filesystem::remove(path);
+}
+
+UTEST_CASE(save_and_map)
+{
+    for (const auto target : {size_t{4U}, size_t{11U}, size_t{12U}, string_t::npos})
+    {
+        UTEST_NAMED_CASE(scat("target=", target));
+
+        auto expected = make_random_datasource(target);
+        expected.testing(make_range(10, 30));
+
+        const auto path = make_path();
+        UTEST_REQUIRE_NOTHROW(expected.save(path));
+
+        auto datasource = binary_datasource_t{"binary", path};
+        UTEST_REQUIRE_NOTHROW(datasource.load());
+        check_equal(datasource, expected);
+
+        // the mapped file stays valid for copies and after removing it from the filesystem
+        const auto cloned = datasource.clone();
+        std::filesystem::remove(path);
+        check_equal(*cloned, expected);
+
+        // a mapped datasource can be saved as well
+        UTEST_REQUIRE_NOTHROW(cloned->save(path));
+
+        auto datasource2 = binary_datasource_t{"binary", path};
+        UTEST_REQUIRE_NOTHROW(datasource2.load());
+        check_equal(datasource2, expected);
+
+        std::filesystem::remove(path);
+    }
+}
+
+UTEST_END_MODULE()
@@ -380,4 +380,72 @@ UTEST_CASE(load_cont_target)
     UTEST_CHECK_THROW(dataset.load(), std::runtime_error);
 }
 
+UTEST_CASE(csv_split)
+{
+    const auto path = "test_datasource_tabular_split.csv";
+    {
+        std::ofstream os(path);
+        os << "cont,cate\n";
+        for (auto index = 0; index < 100; ++index)
+        {
+            os << (0.1 * index) << ",cate" << (index % 3) << "\n";
+            if (index % 7 == 0)
+            {
+                os << "\n";
+            }
+            if (index % 9 == 0)
+            {
+                os << "@ this line should be skipped\n";
+            }
+        }
+        os << "last,line";
+    }
+
+    const auto csv = csv_t{path}.delim(",").header(true).skip('@');
+
+    auto expected = std::vector<std::pair<string_t, tensor_size_t>>{};
+    UTEST_REQUIRE(csv.parse(
+        [&](const string_t& line, const tensor_size_t line_index)
+        {
+            expected.emplace_back(line, line_index);
+            return true;
+        }));
+    UTEST_REQUIRE_EQUAL(expected.size(), 101U);
+
+    for (const auto chunks : {1U, 2U, 3U, 7U, 1000U})
+    {
+        UTEST_NAMED_CASE(scat("chunks=", chunks));
+
+        const auto splits = csv.split(string_t{}, chunks);
+        UTEST_REQUIRE(!splits.empty());
+        UTEST_CHECK_LESS_EQUAL(splits.size(), static_cast<size_t>(chunks));
+        UTEST_CHECK_EQUAL(splits.front().m_begin, 0);
+        UTEST_CHECK_EQUAL(splits.back().m_end, static_cast<std::streamoff>(std::filesystem::file_size(path)));
+
+        auto parsed = std::vector<std::pair<string_t, tensor_size_t>>{};
+        auto line0  = tensor_size_t{0};
+        for (size_t i = 0U; i < splits.size(); ++i)
+        {
+            UTEST_CHECK_LESS(splits[i].m_begin, splits[i].m_end);
+            if (i > 0U)
+            {
+                UTEST_CHECK_EQUAL(splits[i - 1U].m_end, splits[i].m_begin);
+            }
+
+            const auto lines = csv.parse(string_t{}, splits[i],
+                                         [&](const string_t& line, const tensor_size_t line_index)
+                                         {
+                                             parsed.emplace_back(line, line0 + line_index);
+                                             return true;
+                                         });
+            UTEST_REQUIRE_GREATER(lines, 0);
+            line0 += lines;
+        }
+
+        UTEST_CHECK(parsed == expected);
+    }
+
+    std::filesystem::remove(path); // NOLINT(cert-err33-c)
+}
+
 UTEST_END_MODULE()
@@ -342,6 +342,46 @@ UTEST_CASE(linear_inequality)
     UTEST_CHECK_CLOSE(::nano::valid(constraint, make_vector<scalar_t>(2.0, 2.0)), 2.0, 1e-15);
 }
 
+UTEST_CASE(sparse_linear_equality)
+{
+    const auto constraint = constraint_t{
+        sparse_linear_equality_t{make_indices(2, 0), make_vector<scalar_t>(1.0, 1.0), -2.0}
+    };
+
+    UTEST_CHECK(::nano::convex(constraint));
+    UTEST_CHECK(::nano::smooth(constraint));
+    UTEST_CHECK(::nano::is_linear(constraint));
+    UTEST_CHECK(::nano::is_equality(constraint));
+    UTEST_CHECK_CLOSE(::nano::strong_convexity(constraint), 0.0, 1e-15);
+
+    UTEST_CHECK_CLOSE(::nano::valid(constraint, make_vector<scalar_t>(1.0, 5.0, 1.0)), 0.0, 1e-15);
+    UTEST_CHECK_CLOSE(::nano::valid(constraint, make_vector<scalar_t>(1.0, 5.0, 0.0)), 1.0, 1e-15);
+    UTEST_CHECK_CLOSE(::nano::valid(constraint, make_vector<scalar_t>(1.0, 5.0, 2.0)), 1.0, 1e-15);
+    UTEST_CHECK_CLOSE(::nano::valid(constraint, make_vector<scalar_t>(2.0, 5.0, 2.0)), 2.0, 1e-15);
+
+    auto gx = vector_t{3};
+    UTEST_CHECK_CLOSE(::nano::eval(constraint, make_vector<scalar_t>(2.0, 5.0, 3.0), gx), 3.0, 1e-15);
+    UTEST_CHECK_CLOSE(gx, make_vector<scalar_t>(1.0, 0.0, 1.0), 1e-15);
+}
+
+UTEST_CASE(sparse_linear_inequality)
+{
+    const auto constraint = constraint_t{
+        sparse_linear_inequality_t{make_indices(2, 0), make_vector<scalar_t>(1.0, 1.0), -2.0}
+    };
+
+    UTEST_CHECK(::nano::convex(constraint));
+    UTEST_CHECK(::nano::smooth(constraint));
+    UTEST_CHECK(::nano::is_linear(constraint));
+    UTEST_CHECK(!::nano::is_equality(constraint));
+    UTEST_CHECK_CLOSE(::nano::strong_convexity(constraint), 0.0, 1e-15);
+
+    UTEST_CHECK_CLOSE(::nano::valid(constraint, make_vector<scalar_t>(1.0, 5.0, 1.0)), 0.0, 1e-15);
+    UTEST_CHECK_CLOSE(::nano::valid(constraint, make_vector<scalar_t>(1.0, 5.0, 0.0)), 0.0, 1e-15);
+    UTEST_CHECK_CLOSE(::nano::valid(constraint, make_vector<scalar_t>(1.0, 5.0, 2.0)), 1.0, 1e-15);
+    UTEST_CHECK_CLOSE(::nano::valid(constraint, make_vector<scalar_t>(2.0, 5.0, 2.0)), 2.0, 1e-15);
+}
+
 UTEST_CASE(quadratic_equality)
 {
     const auto constraint = constraint_t{
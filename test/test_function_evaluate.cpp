@@ -1,4 +1,7 @@
 #include <fixture/function.h>
+#include <nano/core/parallel.h>
+#include <nano/function/lambda.h>
+#include <nano/function/penalty.h>
 
 using namespace nano;
 
@@ -18,4 +21,53 @@ UTEST_CASE(evaluate)
     }
 }
 
+UTEST_CASE(reentrant)
+{
+    for (const auto& rfunction : function_t::make({4, 4, function_type::any}))
+    {
+        const auto& function = *rfunction;
+        UTEST_NAMED_CASE(function.name());
+
+        // the builtin functions can be evaluated concurrently, but not the ones wrapping them
+        UTEST_CHECK(function.reentrant());
+        UTEST_CHECK(!linear_penalty_function_t{function}.reentrant());
+        UTEST_CHECK(!quadratic_penalty_function_t{function}.reentrant());
+
+        // the points should be evaluated the same way in parallel (also from a worker thread)
+        const auto points = tensor_size_t{64};
+
+        auto xs = make_random_matrix<scalar_t>(points, function.size());
+        auto fx = make_random_vector<scalar_t>(points);
+        auto gx = make_random_matrix<scalar_t>(points, function.size());
+
+        auto fxs = make_random_vector<scalar_t>(points);
+        auto gxs = make_random_matrix<scalar_t>(points, function.size());
+        for (tensor_size_t k = 0; k < points; ++k)
+        {
+            fxs(k) = function(xs.tensor(k), gxs.tensor(k));
+        }
+
+        function.clear_statistics();
+        function.evaluate(xs, fx, gx);
+        UTEST_CHECK_EQUAL(function.fcalls(), points);
+        UTEST_CHECK_EQUAL(function.gcalls(), points);
+        UTEST_CHECK_CLOSE(fx, fxs, epsilon0<scalar_t>());
+        UTEST_CHECK_CLOSE(gx, gxs, epsilon0<scalar_t>());
+
+        parallel::scheduler_t::shared().map(1, [&](tensor_size_t, size_t) { function.evaluate(xs, fx, gx); });
+        UTEST_CHECK_CLOSE(fx, fxs, epsilon0<scalar_t>());
+        UTEST_CHECK_CLOSE(gx, gxs, epsilon0<scalar_t>());
+    }
+
+    const auto lambda = [](vector_cmap_t x, vector_map_t gx, matrix_map_t) -> scalar_t
+    {
+        if (gx.size() == x.size())
+        {
+            gx = x;
+        }
+        return 0.5 * x.dot(x);
+    };
+    UTEST_CHECK(!make_function(3, convexity::yes, smoothness::yes, 1.0, lambda).reentrant());
+}
+
 UTEST_END_MODULE()
@@ -410,4 +410,45 @@ UTEST_CASE(make_linear_constraints)
     }
 }
 
+UTEST_CASE(make_sparse_linear_constraints)
+{
+    auto function = make_function(4, convexity::yes, smoothness::yes, 2.0, lambda);
+
+    const auto check = [&]()
+    {
+        const auto lconstraints = make_linear_constraints(function);
+        const auto sconstraints = make_sparse_linear_constraints(function);
+        UTEST_REQUIRE(lconstraints.has_value());
+        UTEST_REQUIRE(sconstraints.has_value());
+
+        const auto& [A, b, G, h] = sconstraints.value();
+
+        UTEST_CHECK_CLOSE(matrix_t{A.toDense()}, lconstraints->m_A, epsilon0<scalar_t>());
+        UTEST_CHECK_CLOSE(b, lconstraints->m_b, epsilon0<scalar_t>());
+        UTEST_CHECK_CLOSE(matrix_t{G.toDense()}, lconstraints->m_G, epsilon0<scalar_t>());
+        UTEST_CHECK_CLOSE(h, lconstraints->m_h, epsilon0<scalar_t>());
+    };
+
+    check();
+    critical(function.variable() >= 2.0);
+    check();
+    critical(vector_t::constant(4, 1.0) * function.variable() == 12.0);
+    check();
+    critical(function.constrain(constraint::sparse_linear_equality_t{make_indices(0, 3, 0),
+                                                                     make_vector<scalar_t>(1.0, -2.0, 0.5), 1.0}));
+    critical(function.constrain(
+        constraint::sparse_linear_inequality_t{make_indices(2), make_vector<scalar_t>(3.0), -4.0}));
+    check();
+
+    const auto sconstraints = make_sparse_linear_constraints(function);
+    UTEST_REQUIRE(sconstraints.has_value());
+    UTEST_CHECK_EQUAL(sconstraints->m_A.nonZeros(), 6);
+    UTEST_CHECK_EQUAL(sconstraints->m_G.nonZeros(), 5);
+    UTEST_CHECK_CLOSE(sconstraints->m_A.coeff(1, 0), 1.5, epsilon0<scalar_t>());
+
+    UTEST_REQUIRE(
+        function.constrain(constraint::euclidean_ball_equality_t{make_vector<scalar_t>(0.0, 0.0, 0.0, 0.0), 30.0}));
+    UTEST_CHECK(!make_sparse_linear_constraints(function).has_value());
+}
+
 UTEST_END_MODULE()
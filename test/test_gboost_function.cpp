@@ -201,4 +201,41 @@ UTEST_CASE(grads)
     check_optimum(function, targets.vector());
 }
 
+UTEST_CASE(grads_hessians)
+{
+    const auto datasource = make_datasource(20);
+    const auto dataset    = make_dataset(datasource);
+
+    const auto all_samples = arange(0, datasource.samples());
+    const auto odims       = cat_dims(all_samples.size(), dataset.target_dims());
+    const auto denom       = static_cast<scalar_t>(all_samples.size());
+
+    auto iterator = targets_iterator_t{dataset, all_samples};
+    iterator.batch(3);
+
+    for (const auto* const loss_id : {"mse", "cauchy", "m-logistic", "s-classnll"})
+    {
+        UTEST_NAMED_CASE(loss_id);
+
+        const auto loss     = make_loss(loss_id);
+        const auto function = grads_function_t{iterator, *loss};
+
+        const auto x = make_random_vector<scalar_t>(function.size());
+
+        auto       gx = vector_t{function.size()};
+        auto       hx = matrix_t{function.size(), function.size()};
+        const auto fx = function(x, gx, hx);
+
+        // the gradients and the diagonal hessians are consistent with the function_t interface
+        const auto& vgrads = function.gradients(map_tensor(x.data(), odims), true);
+        UTEST_CHECK_CLOSE(function(x), fx, epsilon1<scalar_t>());
+        UTEST_CHECK_CLOSE(vgrads.vector(), gx * denom, epsilon1<scalar_t>());
+        UTEST_CHECK_CLOSE(function.hessians().vector(), hx.diagonal() * denom, epsilon1<scalar_t>());
+
+        // ... and the gradients do not change if the hessians are not requested
+        const auto& vgrads2 = function.gradients(map_tensor(x.data(), odims));
+        UTEST_CHECK_CLOSE(vgrads2.vector(), gx * denom, epsilon1<scalar_t>());
+    }
+}
+
 UTEST_END_MODULE()
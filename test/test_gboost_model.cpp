@@ -284,4 +284,48 @@ UTEST_CASE(tune_shrinkage_local)
     check_result(result, param_names);
 }
 
+UTEST_CASE(predict_compiled)
+{
+    const auto loss       = make_loss("mse");
+    const auto datasource = make_datasource<fixture_affine_datasource_t>(300);
+    const auto dataset    = make_dataset(datasource);
+    const auto samples    = arange(0, dataset.samples());
+    const auto fit_params = params_t{}.splitter(make_splitter("k-fold", 2, 42U));
+
+    for (const auto* const id : {"stump", "hinge", "affine", "dtree"})
+    {
+        UTEST_NAMED_CASE(id);
+
+        auto wlearners = rwlearners_t{};
+        wlearners.emplace_back(wlearner_t::all().get(id));
+
+        auto model = make_gbooster_to_fit("gboost::max_rounds", 20);
+        model.prototypes(wlearners);
+        UTEST_REQUIRE_NOTHROW(model.fit(dataset, samples, *loss, fit_params));
+        UTEST_REQUIRE_GREATER(model.wlearners().size(), 0U);
+
+        // NB: the look-up tables are not lowered, but they are checked when fitting on categorical features.
+        const auto& compiled = model.compiled();
+        UTEST_CHECK(compiled.fallbacks().empty());
+        UTEST_CHECK_GREATER(compiled.nodes(), 0);
+
+        // check the compiled model on various subsets of samples
+        check_compiled(model, dataset, samples);
+        check_compiled(model, dataset, make_indices(5, 3, 299, 0, 1, 200));
+        check_compiled(model, dataset, arange(10, 20));
+
+        // ... and with missing feature values
+        for (const auto feature : model.features())
+        {
+            dataset.drop(feature);
+            check_compiled(model, dataset, samples);
+            dataset.undrop();
+        }
+
+        // ... and after copying and serialization
+        check_compiled(gboost_model_t{model}, dataset, samples);
+        check_compiled(check_stream(model), dataset, samples);
+    }
+}
+
 UTEST_END_MODULE()
@@ -1,3 +1,4 @@
+#include <fixture/datasource/random.h>
 #include <fixture/generator.h>
 #include <fixture/generator_datasource.h>
 #include <nano/generator/elemwise_identity.h>
@@ -523,4 +524,77 @@ UTEST_CASE(mvregression)
         make_tensor<scalar_t>(make_dims(4), 3.027650354097, 3.027650354097, 3.027650354097, 3.027650354097));
 }
 
+UTEST_CASE(view)
+{
+    const auto features = features_t{
+        feature_t{"scalar0"}.scalar(feature_type::float64),
+        feature_t{"scalar1"}.scalar(feature_type::int16),
+        feature_t{"scalar2"}.scalar(feature_type::float32),
+        feature_t{"target"}.scalar(feature_type::float64),
+    };
+
+    // NB: the last scalar feature has a missing value, so it cannot be mapped directly!
+    auto hits  = make_full_tensor<int8_t>(make_dims(100, 4), 1);
+    hits(7, 2) = 0;
+
+    auto datasource = random_datasource_t{100, features, 3U, hits};
+    UTEST_REQUIRE_NOTHROW(datasource.load());
+
+    auto dataset = dataset_t{datasource};
+    add_generator<scalar_identity_generator_t>(dataset);
+    UTEST_REQUIRE_EQUAL(dataset.features(), 3);
+
+    using f64_view_t = tensor_cmap_t<double, 1>;
+    using i16_view_t = tensor_cmap_t<int16_t, 1>;
+
+    const auto all      = arange(0, 100);
+    const auto range    = arange(10, 30);
+    const auto reversed = make_indices(1, 0, 3, 2, 5, 4);
+
+    auto buffer   = scalar_mem_t{};
+    auto expected = scalar_mem_t{};
+    for (tensor_size_t feature = 0; feature < 3; ++feature)
+    {
+        UTEST_NAMED_CASE(scat("feature=", feature));
+
+        // the feature values are mapped directly only for all feature values given and contiguous samples
+        UTEST_CHECK_EQUAL(std::holds_alternative<std::monostate>(dataset.view(all, feature)), feature == 2);
+        UTEST_CHECK_EQUAL(std::holds_alternative<std::monostate>(dataset.view(range, feature)), feature == 2);
+        UTEST_CHECK(std::holds_alternative<std::monostate>(dataset.view(reversed, feature)));
+
+        // the feature values are not converted
+        UTEST_CHECK_EQUAL(std::holds_alternative<f64_view_t>(dataset.view(all, feature)), feature == 0);
+        UTEST_CHECK_EQUAL(std::holds_alternative<i16_view_t>(dataset.view(all, feature)), feature == 1);
+
+        // the feature values are the same irrespective of being mapped directly or gathered
+        const auto gathered = dataset.select(reversed, feature, expected);
+        dataset.visit(arange(0, 6), feature, buffer,
+                      [&](const auto& values)
+                      {
+                          UTEST_REQUIRE_EQUAL(values.size(), 6);
+                          for (tensor_size_t i = 0; i < 6; ++i)
+                          {
+                              UTEST_CHECK_CLOSE(static_cast<scalar_t>(values(i)), gathered(i ^ 1), 1e-12);
+                          }
+                      });
+
+        // the selected feature values are mapped without copying if stored with the same precision
+        const auto values = dataset.select(all, feature, buffer);
+        UTEST_CHECK_EQUAL(values.data() != buffer.data(), feature == 0);
+    }
+
+    // the dropped or shuffled features cannot be mapped directly
+    dataset.drop(0);
+    UTEST_CHECK(std::holds_alternative<std::monostate>(dataset.view(all, 0)));
+
+    dataset.undrop();
+    UTEST_CHECK(std::holds_alternative<f64_view_t>(dataset.view(all, 0)));
+
+    dataset.shuffle(0);
+    UTEST_CHECK(std::holds_alternative<std::monostate>(dataset.view(all, 0)));
+
+    dataset.unshuffle();
+    UTEST_CHECK(std::holds_alternative<f64_view_t>(dataset.view(all, 0)));
+}
+
 UTEST_END_MODULE()
@@ -1,3 +1,4 @@
+#include <filesystem>
 #include <fixture/datasource/linear.h>
 #include <fixture/function.h>
 #include <fixture/linear.h>
@@ -149,6 +150,249 @@ UTEST_CASE(function_l2reg)
     check_function(function, function_config_t{.m_trials = trials});
 }
 
+UTEST_CASE(function_float32)
+{
+    const auto trials   = 10;
+    const auto targets  = tensor_size_t{3};
+    const auto samples  = tensor_size_t{50};
+    const auto features = tensor_size_t{4};
+    const auto scaling  = scaling_type::standard;
+    const auto loss     = make_loss(scaling);
+    const auto batch    = make_batch(scaling);
+
+    const auto datasource = make_linear_datasource(samples, targets, features);
+    const auto dataset    = make_dataset(datasource);
+
+    auto iterator64 = flatten_iterator_t{dataset, arange(0, samples)};
+    iterator64.batch(batch);
+    iterator64.scaling(scaling);
+
+    auto iterator32 = flatten_iterator_t{dataset, arange(0, samples)};
+    iterator32.batch(batch);
+    iterator32.scaling(scaling);
+    iterator32.precision(precision_type::float32);
+    UTEST_CHECK_EQUAL(iterator32.precision(), precision_type::float32);
+
+    const auto function64 = linear::function_t{iterator64, *loss, 0.0, 1.0};
+    const auto function32 = linear::function_t{iterator32, *loss, 0.0, 1.0};
+
+    // the single precision path should match the double precision one up to the float32 rounding errors
+    for (const auto cache : {false, true})
+    {
+        UTEST_NAMED_CASE(scat("cache=", cache));
+
+        if (cache)
+        {
+            UTEST_CHECK(!iterator32.cache_flatten(samples * dataset.columns() * 4 - 1));
+            UTEST_CHECK(iterator32.cache_flatten(samples * dataset.columns() * 4));
+        }
+
+        for (auto trial = 0; trial < trials; ++trial)
+        {
+            const auto x = make_random_vector<scalar_t>(function64.size());
+
+            auto gx64 = make_full_vector<scalar_t>(function64.size(), 0.0);
+            auto gx32 = make_full_vector<scalar_t>(function32.size(), 0.0);
+
+            const auto fx64 = function64(x, gx64);
+            const auto fx32 = function32(x, gx32);
+
+            UTEST_CHECK_CLOSE(fx32, fx64, 1e-5);
+            UTEST_CHECK_CLOSE(gx32, gx64, 1e-5);
+        }
+
+        // the double precision loop over single precision cached features is consistent as well
+        auto inputs32 = tensor2d_t{samples, dataset.columns()};
+        auto inputs64 = tensor2d_t{samples, dataset.columns()};
+        iterator32.loop([&](tensor_range_t range, size_t, tensor2d_cmap_t inputs) { inputs32.slice(range) = inputs; });
+        iterator64.loop([&](tensor_range_t range, size_t, tensor2d_cmap_t inputs) { inputs64.slice(range) = inputs; });
+        UTEST_CHECK_CLOSE(inputs32, inputs64, 1e-6);
+    }
+}
+
+UTEST_CASE(function_spill)
+{
+    const auto trials   = 5;
+    const auto targets  = tensor_size_t{2};
+    const auto samples  = tensor_size_t{50};
+    const auto features = tensor_size_t{4};
+    const auto scaling  = scaling_type::standard;
+    const auto loss     = make_loss(scaling);
+    const auto batch    = tensor_size_t{7};
+    const auto path     = (std::filesystem::temp_directory_path() / "test_linear_function.flatten").string();
+
+    const auto datasource = make_linear_datasource(samples, targets, features);
+    const auto dataset    = make_dataset(datasource);
+
+    for (const auto precision : enum_values<precision_type>())
+    {
+        auto iterator = flatten_iterator_t{dataset, arange(0, samples)};
+        iterator.batch(batch);
+        iterator.scaling(scaling);
+        iterator.precision(precision);
+        UTEST_REQUIRE(iterator.cache_flatten(std::numeric_limits<tensor_size_t>::max()));
+
+        auto spilled_iterator = flatten_iterator_t{dataset, arange(0, samples)};
+        spilled_iterator.batch(batch);
+        spilled_iterator.scaling(scaling);
+        spilled_iterator.precision(precision);
+
+        const auto function         = linear::function_t{iterator, *loss, 0.0, 1.0};
+        const auto spilled_function = linear::function_t{spilled_iterator, *loss, 0.0, 1.0};
+
+        const auto scalar_bytes = precision == precision_type::float32 ? sizeof(float) : sizeof(scalar_t);
+        const auto row_bytes    = static_cast<tensor_size_t>(scalar_bytes) * dataset.columns();
+
+        for (const auto rows : {tensor_size_t{0}, tensor_size_t{13}, tensor_size_t{14}, samples})
+        {
+            UTEST_NAMED_CASE(scat("precision=", precision, ",rows=", rows));
+
+            UTEST_CHECK_EQUAL(spilled_iterator.cache_flatten(rows * row_bytes + 1, path), rows);
+            UTEST_CHECK_EQUAL(std::filesystem::exists(path), rows < samples);
+
+            // the spilled feature values should be identical to the ones cached in memory
+            auto inputs         = tensor2d_t{samples, dataset.columns()};
+            auto spilled_inputs = tensor2d_t{samples, dataset.columns()};
+            iterator.loop([&](tensor_range_t range, size_t, tensor2d_cmap_t data) { inputs.slice(range) = data; });
+            spilled_iterator.loop([&](tensor_range_t range, size_t, tensor2d_cmap_t data)
+                                  { spilled_inputs.slice(range) = data; });
+            UTEST_CHECK_CLOSE(spilled_inputs, inputs, epsilon0<scalar_t>());
+
+            for (auto trial = 0; trial < trials; ++trial)
+            {
+                const auto x = make_random_vector<scalar_t>(function.size());
+
+                auto gx         = make_full_vector<scalar_t>(function.size(), 0.0);
+                auto spilled_gx = make_full_vector<scalar_t>(function.size(), 0.0);
+
+                UTEST_CHECK_CLOSE(spilled_function(x, spilled_gx), function(x, gx), epsilon0<scalar_t>());
+                UTEST_CHECK_CLOSE(spilled_gx, gx, epsilon0<scalar_t>());
+            }
+        }
+
+        // the scratch file is removed with the cached feature values
+        UTEST_CHECK_EQUAL(spilled_iterator.cache_flatten(0, path), 0);
+        UTEST_CHECK(std::filesystem::exists(path));
+        UTEST_CHECK(!spilled_iterator.cache_flatten(0));
+        UTEST_CHECK(!std::filesystem::exists(path));
+    }
+}
+
+UTEST_CASE(function_shared_cache)
+{
+    const auto trials   = 5;
+    const auto targets  = tensor_size_t{2};
+    const auto samples  = tensor_size_t{50};
+    const auto features = tensor_size_t{4};
+    const auto scaling  = scaling_type::standard;
+    const auto loss     = make_loss(scaling);
+    const auto batch    = tensor_size_t{7};
+
+    const auto datasource = make_linear_datasource(samples, targets, features);
+    const auto dataset    = make_dataset(datasource);
+
+    for (const auto precision : enum_values<precision_type>())
+    {
+        UTEST_NAMED_CASE(scat("precision=", precision));
+
+        const auto epsilon = precision == precision_type::float32 ? 1e-6 : epsilon0<scalar_t>();
+        const auto cache   = std::make_shared<const flatten_cache_t>(dataset, arange(0, samples), precision, batch);
+
+        // the feature values of a fold should be scaled with the statistics of the fold
+        for (const auto& fold : {arange(0, samples), arange(10, 40), arange(25, samples)})
+        {
+            auto iterator = flatten_iterator_t{dataset, fold};
+            iterator.batch(batch);
+            iterator.scaling(scaling);
+            iterator.precision(precision);
+            UTEST_REQUIRE(iterator.cache_flatten(std::numeric_limits<tensor_size_t>::max()));
+
+            auto shared_iterator = flatten_iterator_t{dataset, fold};
+            shared_iterator.batch(batch);
+            shared_iterator.scaling(scaling);
+            shared_iterator.precision(precision);
+            UTEST_REQUIRE(shared_iterator.cache_flatten(cache));
+
+            auto inputs        = tensor2d_t{fold.size(), dataset.columns()};
+            auto shared_inputs = tensor2d_t{fold.size(), dataset.columns()};
+            iterator.loop([&](tensor_range_t range, size_t, tensor2d_cmap_t data) { inputs.slice(range) = data; });
+            shared_iterator.loop([&](tensor_range_t range, size_t, tensor2d_cmap_t data)
+                                 { shared_inputs.slice(range) = data; });
+            UTEST_CHECK_CLOSE(shared_inputs, inputs, epsilon);
+
+            const auto function        = linear::function_t{iterator, *loss, 0.0, 1.0};
+            const auto shared_function = linear::function_t{shared_iterator, *loss, 0.0, 1.0};
+            for (auto trial = 0; trial < trials; ++trial)
+            {
+                const auto x = make_random_vector<scalar_t>(function.size());
+
+                auto gx        = make_full_vector<scalar_t>(function.size(), 0.0);
+                auto shared_gx = make_full_vector<scalar_t>(function.size(), 0.0);
+
+                UTEST_CHECK_CLOSE(shared_function(x, shared_gx), function(x, gx), epsilon);
+                UTEST_CHECK_CLOSE(shared_gx, gx, epsilon);
+            }
+        }
+
+        // the shared cache cannot be used if some samples are not cached
+        const auto partial  = std::make_shared<const flatten_cache_t>(dataset, arange(10, 40), precision, batch);
+        auto       iterator = flatten_iterator_t{dataset, arange(0, samples)};
+        UTEST_CHECK(!iterator.cache_flatten(partial));
+        UTEST_CHECK(!iterator.cache_flatten(rflatten_cache_t{}));
+    }
+}
+
+UTEST_CASE(function_sparse)
+{
+    const auto trials   = 5;
+    const auto targets  = tensor_size_t{2};
+    const auto samples  = tensor_size_t{50};
+    const auto features = tensor_size_t{8};
+    const auto batch    = tensor_size_t{7};
+
+    for (const auto missing : {0, 30})
+    {
+        const auto datasource =
+            make_linear_datasource(samples, targets, features, "datasource::linear::missing", missing);
+        const auto dataset = make_dataset(datasource);
+        UTEST_REQUIRE_GREATER(dataset.sparse_columns().size(), 0);
+
+        for (const auto scaling : enum_values<scaling_type>())
+        {
+            UTEST_NAMED_CASE(scat("missing=", missing, ",scaling=", scaling));
+
+            const auto loss = make_loss(scaling);
+
+            auto iterator = flatten_iterator_t{dataset, arange(0, samples)};
+            iterator.batch(batch);
+            iterator.scaling(scaling);
+            UTEST_REQUIRE(iterator.cache_flatten(std::numeric_limits<tensor_size_t>::max()));
+            UTEST_CHECK(!iterator.sparse());
+
+            auto sparse_iterator = flatten_iterator_t{dataset, arange(0, samples)};
+            sparse_iterator.batch(batch);
+            sparse_iterator.scaling(scaling);
+            UTEST_CHECK(!sparse_iterator.cache_sparse(0));
+            UTEST_CHECK(!sparse_iterator.sparse());
+            UTEST_REQUIRE(sparse_iterator.cache_sparse(std::numeric_limits<tensor_size_t>::max()));
+            UTEST_CHECK(sparse_iterator.sparse());
+
+            const auto function        = linear::function_t{iterator, *loss, 0.0, 1.0};
+            const auto sparse_function = linear::function_t{sparse_iterator, *loss, 0.0, 1.0};
+            for (auto trial = 0; trial < trials; ++trial)
+            {
+                const auto x = make_random_vector<scalar_t>(function.size());
+
+                auto gx        = make_full_vector<scalar_t>(function.size(), 0.0);
+                auto sparse_gx = make_full_vector<scalar_t>(function.size(), 0.0);
+
+                UTEST_CHECK_CLOSE(sparse_function(x, sparse_gx), function(x, gx), epsilon1<scalar_t>());
+                UTEST_CHECK_CLOSE(sparse_gx, gx, epsilon1<scalar_t>());
+            }
+        }
+    }
+}
+
 UTEST_CASE(minimize_noreg)
 {
     const auto targets  = tensor_size_t{1};
@@ -13,6 +13,7 @@ UTEST_CASE(accumulator)
 {
     const auto fill_accumulator = [](linear::accumulator_t& accumulator, const scalar_t value)
     {
+        accumulator.hessian(true);
         accumulator.m_fx = value;
         accumulator.m_gb.full(value);
         accumulator.m_gw.full(value);
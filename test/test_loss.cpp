@@ -147,6 +147,72 @@ UTEST_CASE(gradient)
     }
 }
 
+UTEST_CASE(fused_eval)
+{
+    for (const auto& loss_id : loss_t::all().ids())
+    {
+        for (const tensor_size_t classes : {1, 3, 7})
+        {
+            UTEST_NAMED_CASE(scat(loss_id, "/classes=", classes));
+
+            const auto loss = make_loss(loss_id);
+
+            auto targets = tensor4d_t{11, classes, 1, 1};
+            for (tensor_size_t sample = 0; sample < targets.size<0>(); ++sample)
+            {
+                targets.tensor(sample) = class_target(classes, sample % classes);
+            }
+
+            for (const auto scale : {1.0, 10.0, 100.0})
+            {
+                auto outputs = make_random_tensor<scalar_t>(targets.dims(), -scale, +scale);
+
+                auto values = tensor1d_t{};
+                auto vgrads = tensor4d_t{};
+                auto vhesss = tensor7d_t{};
+                loss->value(targets, outputs, values);
+                loss->vgrad(targets, outputs, vgrads);
+                if (loss->smooth())
+                {
+                    loss->vhess(targets, outputs, vhesss);
+                }
+
+                // all requested
+                auto fvalues = tensor1d_t{};
+                auto fvgrads = tensor4d_t{};
+                auto fvhesss = tensor7d_t{};
+                loss->eval(targets, outputs, fvalues, &fvgrads, loss->smooth() ? &fvhesss : nullptr);
+
+                UTEST_CHECK_CLOSE(fvalues, values, epsilon1<scalar_t>());
+                UTEST_CHECK_CLOSE(fvgrads, vgrads, epsilon1<scalar_t>());
+                if (loss->smooth())
+                {
+                    UTEST_CHECK_CLOSE(fvhesss, vhesss, epsilon1<scalar_t>());
+                }
+
+                // only the values
+                fvgrads.full(std::numeric_limits<scalar_t>::quiet_NaN());
+                loss->eval(targets, outputs, fvalues);
+                UTEST_CHECK_CLOSE(fvalues, values, epsilon1<scalar_t>());
+
+                // only the gradients
+                fvalues.full(std::numeric_limits<scalar_t>::quiet_NaN());
+                loss->eval(targets, outputs, tensor1d_map_t{}, fvgrads.tensor());
+                UTEST_CHECK_CLOSE(fvgrads, vgrads, epsilon1<scalar_t>());
+                UTEST_CHECK(!fvalues.all_finite());
+
+                // only the hessians
+                if (loss->smooth())
+                {
+                    fvhesss.full(std::numeric_limits<scalar_t>::quiet_NaN());
+                    loss->eval(targets, outputs, tensor1d_map_t{}, tensor4d_map_t{}, fvhesss.tensor());
+                    UTEST_CHECK_CLOSE(fvhesss, vhesss, epsilon1<scalar_t>());
+                }
+            }
+        }
+    }
+}
+
 UTEST_CASE(single_class)
 {
     for (const auto& loss_id : loss_t::all().ids(std::regex("s-.+")))
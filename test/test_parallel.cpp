@@ -24,8 +24,8 @@ auto test_single(size_t size, const toperator op)
 }
 
 // multi-threaded (by index)
-template <class toperator>
-auto test_loopi(parallel::pool_t& pool, size_t size, const toperator op)
+template <class tpool, class toperator>
+auto test_loopi(tpool& pool, size_t size, const toperator op)
 {
     std::vector<double> results(size, -1);
     pool.map(size,
@@ -41,8 +41,8 @@ auto test_loopi(parallel::pool_t& pool, size_t size, const toperator op)
 }
 
 // multi-threaded (by range)
-template <class toperator>
-auto test_loopr(parallel::pool_t& pool, size_t size, size_t chunk, const toperator op)
+template <class tpool, class toperator>
+auto test_loopr(tpool& pool, size_t size, size_t chunk, const toperator op)
 {
     std::vector<double> results(size, -1);
     pool.map(size, chunk, // NOLINT(readability-suspicious-call-argument)
@@ -208,4 +208,120 @@ UTEST_CASE(loopr)
     }
 }
 
+UTEST_CASE(scheduler_init)
+{
+    {
+        auto pool = parallel::scheduler_t{0U};
+        UTEST_CHECK_EQUAL(pool.size(), 1U);
+    }
+    {
+        auto pool = parallel::scheduler_t{1U};
+        UTEST_CHECK_EQUAL(pool.size(), 1U);
+    }
+    {
+        auto pool = parallel::scheduler_t{};
+        UTEST_CHECK_EQUAL(pool.size(), std::thread::hardware_concurrency());
+    }
+    {
+        auto pool = parallel::scheduler_t{std::thread::hardware_concurrency() + 1U};
+        UTEST_CHECK_EQUAL(pool.size(), std::thread::hardware_concurrency());
+    }
+}
+
+UTEST_CASE(scheduler_shared)
+{
+    auto& scheduler = parallel::scheduler_t::shared();
+    UTEST_CHECK_EQUAL(scheduler.size(), parallel::pool_t::max_size());
+    UTEST_CHECK_EQUAL(&scheduler, &parallel::scheduler_t::shared());
+}
+
+UTEST_CASE(scheduler_loopi)
+{
+    const auto op = [](size_t i) { return std::sin(i); };
+
+    for (const auto threads : thread_counts())
+    {
+        auto pool = parallel::scheduler_t{threads};
+
+        for (size_t size = 1; size <= size_t(12345); size *= 3)
+        {
+            const auto eps = epsilon1<double>();
+            const auto ref = test_single(size, op);
+
+            UTEST_CHECK_CLOSE(ref, test_loopi(pool, size, op), eps);
+        }
+    }
+}
+
+UTEST_CASE(scheduler_loopr)
+{
+    const auto op = [](size_t i) { return std::cos(i); };
+
+    for (const auto threads : thread_counts())
+    {
+        auto pool = parallel::scheduler_t{threads};
+
+        for (size_t size = 1; size <= size_t(128); size *= 2)
+        {
+            const auto eps = epsilon1<double>();
+            const auto ref = test_single(size, op);
+
+            UTEST_CHECK_CLOSE(ref, test_loopr(pool, size, 1, op), eps);
+            UTEST_CHECK_CLOSE(ref, test_loopr(pool, size, 2, op), eps);
+            UTEST_CHECK_CLOSE(ref, test_loopr(pool, size, 3, op), eps);
+            UTEST_CHECK_CLOSE(ref, test_loopr(pool, size, 4, op), eps);
+            UTEST_CHECK_CLOSE(ref, test_loopr(pool, size, size, op), eps);
+            UTEST_CHECK_CLOSE(ref, test_loopr(pool, size, size + 1, op), eps);
+        }
+    }
+}
+
+UTEST_CASE(scheduler_nested)
+{
+    const auto op = [](size_t i) { return std::sin(i); };
+
+    for (const auto threads : thread_counts())
+    {
+        auto pool = parallel::scheduler_t{threads};
+
+        const auto outer = size_t{17};
+        const auto inner = size_t{1001};
+        const auto ref   = test_single(inner, op);
+
+        // NB: the nested calls are processed by the calling worker and by the idle workers stealing ranges!
+        std::vector<double> results(outer, 0.0);
+        pool.map(outer,
+                 [&](const size_t i, const size_t tnum)
+                 {
+                     UTEST_CHECK_LESS(tnum, pool.size());
+                     results[i] = test_loopi(pool, inner, op);
+                 });
+
+        for (const auto result : results)
+        {
+            UTEST_CHECK_CLOSE(result, ref, epsilon1<double>());
+        }
+    }
+}
+
+UTEST_CASE(scheduler_exception)
+{
+    for (const auto threads : thread_counts())
+    {
+        auto pool = parallel::scheduler_t{threads};
+
+        const auto op = [](const size_t i, const size_t)
+        {
+            if (i == 42U)
+            {
+                throw std::runtime_error("failed to process element");
+            }
+        };
+
+        UTEST_CHECK_THROW(pool.map(size_t{100}, op), std::runtime_error);
+        UTEST_CHECK_NOTHROW(pool.map(size_t{100}, op, false));
+        UTEST_CHECK_NOTHROW(pool.map(size_t{42}, op));
+    }
+}
+
 UTEST_END_MODULE()
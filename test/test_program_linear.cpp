@@ -1,4 +1,5 @@
 #include <fixture/solver.h>
+#include <nano/core/random.h>
 #include <nano/function/bounds.h>
 #include <nano/function/cuts.h>
 #include <nano/function/linear.h>
@@ -19,6 +20,14 @@ rsolvers_t make_solvers()
         solver->parameter("solver::max_evals")  = 100;
         solvers.emplace_back(std::move(solver));
     }
+
+    // NB: force the sparse representation even for small programs
+    auto solver                                      = make_solver("ipm");
+    solver->parameter("solver::ipm::sparse_size")    = 0;
+    solver->parameter("solver::ipm::sparse_density") = 1.0;
+    solver->parameter("solver::max_evals")           = 100;
+    solvers.emplace_back(std::move(solver));
+
     return solvers;
 }
 } // namespace
@@ -47,6 +56,10 @@ UTEST_CASE(constrain)
     UTEST_REQUIRE(!function.constrain(euclidean_ball_inequality_t{vector_t::zero(3), 0.0}));
     UTEST_REQUIRE(!function.constrain(quadratic_equality_t{matrix_t::zero(3, 3), vector_t::zero(3), 0.0}));
     UTEST_REQUIRE(!function.constrain(quadratic_inequality_t{matrix_t::zero(3, 3), vector_t::zero(3), 0.0}));
+    UTEST_REQUIRE(function.constrain(sparse_linear_equality_t{make_indices(0, 2), make_vector<scalar_t>(1, 2), 0.0}));
+    UTEST_REQUIRE(function.constrain(sparse_linear_inequality_t{make_indices(1), make_vector<scalar_t>(1), 0.0}));
+    UTEST_REQUIRE(!function.constrain(sparse_linear_inequality_t{make_indices(3), make_vector<scalar_t>(1), 0.0}));
+    UTEST_REQUIRE(!function.constrain(sparse_linear_inequality_t{make_indices(1, 2), make_vector<scalar_t>(1), 0.0}));
 }
 
 UTEST_CASE(program1)
@@ -83,6 +96,33 @@ UTEST_CASE(program2)
     check_minimize(make_solvers(), function);
 }
 
+UTEST_CASE(sparse_program)
+{
+    const auto n = tensor_size_t{300};
+
+    auto rng = make_rng(42);
+    auto c   = vector_t{n};
+    urand(-1.0, +1.0, c.begin(), c.end(), rng);
+
+    // bounded and feasible (x = 0) program with few non-zeros per constraint
+    auto function = linear_program_t{"sparse-lp", c};
+    UTEST_REQUIRE(function.variable() >= -1.0);
+    UTEST_REQUIRE(function.variable() <= +1.0);
+    for (tensor_size_t i = 0; i < n / 2; ++i)
+    {
+        auto indices = indices_t{5};
+        auto values  = vector_t{5};
+        urand<tensor_size_t>(0, n - 1, indices.begin(), indices.end(), rng);
+        urand(-1.0, +1.0, values.begin(), values.end(), rng);
+
+        UTEST_REQUIRE(function.constrain(sparse_linear_inequality_t{indices, values, -urand(0.1, 1.0, rng)}));
+    }
+    UTEST_REQUIRE(function.constrain(sparse_linear_equality_t{make_indices(0, 1), make_vector<scalar_t>(1, -1), 0.0}));
+
+    // NB: the dense and the sparse paths should reach the same solution
+    check_minimize(make_solvers(), function, vector_t::zero(n));
+}
+
 UTEST_CASE(factory)
 {
     for (const auto& function : function_t::make({2, 16, function_type::linear_program}))
@@ -19,6 +19,14 @@ rsolvers_t make_solvers()
         solver->parameter("solver::max_evals")  = 100;
         solvers.emplace_back(std::move(solver));
     }
+
+    // NB: force the sparse representation even for small programs
+    auto solver                                      = make_solver("ipm");
+    solver->parameter("solver::ipm::sparse_size")    = 0;
+    solver->parameter("solver::ipm::sparse_density") = 1.0;
+    solver->parameter("solver::max_evals")           = 100;
+    solvers.emplace_back(std::move(solver));
+
     return solvers;
 }
 } // namespace
@@ -1,4 +1,6 @@
+#include <fixture/function.h>
 #include <fixture/solver.h>
+#include <solver/bundle/bundle.h>
 
 using namespace nano;
 
@@ -20,6 +22,104 @@ namespace
 
 UTEST_BEGIN_MODULE()
 
+UTEST_CASE(simplex_qp)
+{
+    auto solver = simplex_qp_t{};
+
+    for (const tensor_size_t dims : {1, 2, 5, 20})
+    {
+        for (const tensor_size_t size : {1, 2, 3, 7, 16, 31})
+        {
+            UTEST_NAMED_CASE(scat("dims=", dims, ",size=", size));
+
+            const auto G = make_random_matrix<scalar_t>(size, dims);
+            const auto q = make_random_vector<scalar_t>(size);
+
+            auto H     = matrix_t{size, size};
+            H.matrix() = G.matrix() * G.matrix().transpose();
+
+            for (const auto warm : {false, true})
+            {
+                auto alphas = warm ? make_random_vector<scalar_t>(size, 0.0, 1.0) : make_full_vector<scalar_t>(size, 0.0);
+                UTEST_REQUIRE(solver.solve(H.tensor(), q.tensor(), alphas.tensor()));
+
+                // check KKT optimality conditions
+                auto g     = vector_t{size};
+                auto mu    = std::numeric_limits<scalar_t>::max();
+                g.vector() = H.matrix() * alphas.vector() + q.vector();
+                for (tensor_size_t i = 0; i < size; ++i)
+                {
+                    if (alphas(i) > 0.0)
+                    {
+                        mu = std::min(mu, g(i));
+                    }
+                }
+
+                UTEST_CHECK_GREATER_EQUAL(alphas.min(), 0.0);
+                UTEST_CHECK_CLOSE(alphas.sum(), 1.0, epsilon1<scalar_t>());
+                UTEST_CHECK_GREATER_EQUAL(g.min() + epsilon1<scalar_t>() * (1.0 + g.vector().lpNorm<Eigen::Infinity>()), mu);
+                for (tensor_size_t i = 0; i < size; ++i)
+                {
+                    if (alphas(i) > 0.0)
+                    {
+                        UTEST_CHECK_CLOSE(g(i), mu, epsilon2<scalar_t>());
+                    }
+                }
+            }
+        }
+    }
+}
+
+UTEST_CASE(dual_proximal_problem)
+{
+    const auto logger = make_null_logger();
+
+    for (const auto& function : function_t::make({4, 4, function_type::convex_nonsmooth}))
+    {
+        UTEST_NAMED_CASE(function->name());
+
+        const auto x0     = make_random_x0(*function);
+        const auto state0 = solver_state_t{*function, x0};
+
+        auto bundle = bundle_t{state0, 10};
+        for (auto trial = 0; trial < 20; ++trial)
+        {
+            const auto tau = 0.1 + 0.1 * trial;
+
+            // NB: no level constraint => solved as the dual problem on the unit simplex (warm-started),
+            //  but the interior-point method is used as a fallback and it may not converge for some badly conditioned
+            //  problems!
+            const auto solution = bundle.solve(tau, std::numeric_limits<scalar_t>::infinity(), logger);
+            UTEST_REQUIRE_EQUAL(solution.m_alphas.size(), bundle.size());
+            if (solution.m_status == solver_status::kkt_optimality_test)
+            {
+                UTEST_CHECK_GREATER_EQUAL(solution.m_alphas.min(), 0.0);
+                UTEST_CHECK_CLOSE(solution.m_alphas.sum(), 1.0, epsilon2<scalar_t>());
+                UTEST_CHECK_CLOSE(solution.m_r, bundle.fhat(solution.m_x), epsilon2<scalar_t>());
+            }
+
+            // NB: inactive level constraint => solved with the interior-point method, but the same optimum
+            const auto expected = bundle.solve(tau, solution.m_r + 1.0, logger);
+            if (solution.m_status == solver_status::kkt_optimality_test &&
+                expected.m_status == solver_status::kkt_optimality_test)
+            {
+                const auto objective = [&](const bundle_t::solution_t& sol)
+                { return sol.m_r + 0.5 / tau * (sol.m_x - bundle.x()).squaredNorm(); };
+
+                const auto fx = objective(solution);
+                const auto fe = objective(expected);
+                UTEST_CHECK_LESS_EQUAL(fx, fe + 1e-6 * (1.0 + std::fabs(fe)));
+            }
+
+            // update the bundle with a new (null step) linearization
+            auto       gy = vector_t{x0.size()};
+            const auto y  = make_random_x0(*function);
+            const auto fy = (*function)(y, gy);
+            bundle.append(y, gy, fy);
+        }
+    }
+}
+
 /*UTEST_CASE(smooth_bundle)
 {
     check_minimize(make_solvers(), function_t::make({4, 4, function_type::convex_smooth}));
@@ -24,4 +24,31 @@ UTEST_CASE(nonsmooth)
     check_minimize(make_solver_ids(), function_t::make({4, 4, function_type::convex_nonsmooth}));
 }*/
 
+UTEST_CASE(reproducible)
+{
+    const auto function = function_t::all().get("maxq");
+    UTEST_REQUIRE(function);
+
+    const auto rfunction = function->make(4);
+    UTEST_REQUIRE(rfunction);
+
+    const auto x0 = make_random_x0(*rfunction);
+    for (const auto* const solver_id : {"gs", "gs-lbfgs", "ags", "ags-lbfgs"})
+    {
+        UTEST_NAMED_CASE(solver_id);
+
+        auto solver                            = make_solver(solver_id);
+        solver->parameter("solver::max_evals") = 500;
+
+        // the sample points are seeded, so the same solution should be found when minimizing again
+        const auto state1 = solver->minimize(*rfunction, x0, make_null_logger());
+        const auto state2 = solver->minimize(*rfunction, x0, make_null_logger());
+
+        UTEST_CHECK_EQUAL(state1.fcalls(), state2.fcalls());
+        UTEST_CHECK_EQUAL(state1.gcalls(), state2.gcalls());
+        UTEST_CHECK_CLOSE(state1.x(), state2.x(), 0.0);
+        UTEST_CHECK_CLOSE(state1.fx(), state2.fx(), 0.0);
+    }
+}
+
 UTEST_END_MODULE()
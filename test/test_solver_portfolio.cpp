@@ -0,0 +1,75 @@
+#include <fixture/solver.h>
+
+using namespace nano;
+
+namespace
+{
+auto make_portfolio(const string_t& solver_ids, const tensor_size_t starts)
+{
+    auto solver = make_solver("portfolio");
+    solver->parameter("solver::portfolio::solvers") = solver_ids;
+    solver->parameter("solver::portfolio::starts")  = starts;
+    return solver;
+}
+} // namespace
+
+UTEST_BEGIN_MODULE()
+
+UTEST_CASE(smooth)
+{
+    check_minimize(strings_t{"portfolio"}, function_t::make({4, 4, function_type::convex_smooth}));
+}
+
+UTEST_CASE(nonsmooth)
+{
+    check_minimize(strings_t{"portfolio"}, function_t::make({4, 4, function_type::convex_nonsmooth}));
+}
+
+UTEST_CASE(multistart)
+{
+    auto solvers = rsolvers_t{};
+    solvers.emplace_back(make_portfolio("lbfgs", 5));
+    solvers.emplace_back(make_portfolio("cgd-pr,lbfgs", 3));
+
+    for (const auto& function : function_t::make({4, 4, function_type::convex_smooth}))
+    {
+        UTEST_REQUIRE(function);
+        check_minimize(solvers, *function);
+    }
+}
+
+UTEST_CASE(reproducible)
+{
+    for (const auto& function : function_t::make({4, 4, function_type::convex_nonsmooth}))
+    {
+        UTEST_REQUIRE(function);
+        UTEST_NAMED_CASE(function->name());
+
+        const auto solver = make_portfolio("lbfgs,rqb,osga", 4);
+        const auto x0     = make_random_x0(*function);
+
+        const auto state1 = solver->minimize(*function, x0, make_null_logger());
+        const auto state2 = solver->minimize(*function, x0, make_null_logger());
+
+        UTEST_CHECK_EQUAL(state1.fcalls(), state2.fcalls());
+        UTEST_CHECK_EQUAL(state1.gcalls(), state2.gcalls());
+        UTEST_CHECK_EQUAL(state1.status(), state2.status());
+        UTEST_CHECK_CLOSE(state1.x(), state2.x(), epsilon0<scalar_t>());
+        UTEST_CHECK_CLOSE(state1.fx(), state2.fx(), epsilon0<scalar_t>());
+    }
+}
+
+UTEST_CASE(invalid_solvers)
+{
+    const auto function = function_t::make({4, 4, function_type::convex_smooth});
+    UTEST_REQUIRE(!function.empty());
+
+    const auto x0 = make_random_x0(*function[0]);
+    for (const auto* solver_ids : {"", "lbfgs,invalid-solver-id", "portfolio"})
+    {
+        const auto solver = make_portfolio(solver_ids, 1);
+        UTEST_CHECK_THROW(solver->minimize(*function[0], x0, make_null_logger()), std::runtime_error);
+    }
+}
+
+UTEST_END_MODULE()
@@ -2,6 +2,7 @@
 #include <fixture/lsearchk.h>
 #include <fixture/solver.h>
 #include <iomanip>
+#include <solver/newton.h>
 #include <solver/quasi.h>
 
 using namespace nano;
@@ -197,4 +198,135 @@ UTEST_CASE(quasi_bfgs_with_initializations)
     }
 }
 
+UTEST_CASE(lbfgs_with_histories)
+{
+    for (const auto& function : function_t::make({4, 4, function_type::convex_smooth}))
+    {
+        UTEST_REQUIRE(function);
+
+        for (const auto& x0 : make_random_x0s(*function))
+        {
+            // NB: the small histories make the ring buffer wrap around.
+            for (const auto history : {1, 2, 3, 20})
+            {
+                UTEST_NAMED_CASE(scat(function->name(), "/lbfgs/", history));
+
+                const auto solver = make_solver("lbfgs");
+                UTEST_REQUIRE_NOTHROW(solver->parameter("solver::lbfgs::history") = history);
+                check_minimize(*solver, *function, x0);
+            }
+        }
+    }
+}
+
+UTEST_CASE(newton_with_types)
+{
+    for (const auto& function : function_t::make({4, 4, function_type::convex_smooth}))
+    {
+        UTEST_REQUIRE(function);
+
+        for (const auto& x0 : make_random_x0s(*function))
+        {
+            auto config = minimize_config_t{};
+            for (const auto type : {newton_type::ldlt, newton_type::cg})
+            {
+                UTEST_NAMED_CASE(scat(function->name(), "/newton/", type));
+
+                const auto solver = make_solver("newton");
+                UTEST_REQUIRE_NOTHROW(solver->parameter("solver::newton::type") = type);
+
+                const auto state = check_minimize(*solver, *function, x0, config);
+                config.expected_minimum(state.fx());
+            }
+        }
+    }
+}
+
+UTEST_CASE(quasi_compact_representation)
+{
+    const auto n = tensor_size_t{7};
+    const auto m = tensor_size_t{4};
+
+    // NB: the pairs (dx, dg) are generated from a strongly convex quadratic, so that the curvature condition holds.
+    const auto R = make_random_matrix<scalar_t>(n, n);
+    const auto A = matrix_t{R.matrix() * R.matrix().transpose() + eigen_matrix_t<scalar_t>::Identity(n, n)};
+
+    for (const auto formula : {quasi_formula::bfgs, quasi_formula::sr1, quasi_formula::dfp})
+    {
+        auto compact = quasi_compact_t{formula, n, m};
+        compact.reset(0.5);
+
+        auto H = matrix_t{matrix_t::identity(n, n) * 0.5};
+        for (tensor_size_t k = 0; k < 2 * m; ++k)
+        {
+            const auto dx = make_random_vector<scalar_t>(n);
+            const auto dg = vector_t{A.matrix() * dx.vector()};
+
+            UTEST_REQUIRE(compact.update(dx, dg));
+            UTEST_CHECK_EQUAL(compact.pairs(), std::min(k + 1, m));
+
+            if (k >= m)
+            {
+                // NB: the oldest pairs are discarded, so only check against the dense representation before.
+                continue;
+            }
+
+            const auto s   = dx.vector();
+            const auto y   = dg.vector();
+            const auto I   = eigen_matrix_t<scalar_t>::Identity(n, n);
+            const auto Hy  = eigen_vector_t<scalar_t>{H.matrix() * y};
+            const auto z   = eigen_vector_t<scalar_t>{s - Hy};
+            const auto rho = 1.0 / s.dot(y);
+            switch (formula)
+            {
+            case quasi_formula::bfgs:
+                H = matrix_t{(I - rho * s * y.transpose()) * H.matrix() * (I - rho * y * s.transpose()) +
+                             rho * s * s.transpose()};
+                break;
+
+            case quasi_formula::sr1:
+                H = matrix_t{H.matrix() + z * z.transpose() / z.dot(y)};
+                break;
+
+            case quasi_formula::dfp:
+                H = matrix_t{H.matrix() + rho * s * s.transpose() - Hy * Hy.transpose() / y.dot(Hy)};
+                break;
+            }
+
+            const auto g  = make_random_vector<scalar_t>(n);
+            auto       Hg = vector_t{n};
+            compact.apply(g, Hg);
+            UTEST_CHECK_CLOSE(Hg, vector_t{H.matrix() * g.vector()}, 1e-10);
+        }
+
+        compact.reset();
+        UTEST_CHECK_EQUAL(compact.pairs(), 0);
+    }
+}
+
+UTEST_CASE(quasi_compact_solvers)
+{
+    for (const auto& function : function_t::make({4, 4, function_type::convex_smooth}))
+    {
+        UTEST_REQUIRE(function);
+
+        for (const auto& x0 : make_random_x0s(*function))
+        {
+            for (const auto& solver_id : {"sr1", "dfp", "bfgs"})
+            {
+                UTEST_NAMED_CASE(scat(function->name(), "/", solver_id));
+
+                // NB: the limited-memory DFP update may converge slowly on ill-conditioned problems.
+                const auto solver = make_solver(solver_id);
+                UTEST_REQUIRE_NOTHROW(solver->parameter("solver::quasi::history") = 5);
+                UTEST_REQUIRE_NOTHROW(solver->parameter("solver::max_evals") = 10000);
+                check_minimize(*solver, *function, x0);
+
+                UTEST_REQUIRE_NOTHROW(solver->parameter("solver::quasi::initialization") = quasi_initialization::scaled);
+                check_minimize(*solver, *function, x0);
+            }
+        }
+    }
+}
+
 UTEST_END_MODULE()
@@ -7,11 +7,12 @@ using namespace nano;
 
 namespace
 {
-auto make_wdtree(const int min_split, const int max_depth)
+auto make_wdtree(const int min_split, const int max_depth, const int bins = 0)
 {
     auto wlearner                                    = dtree_wlearner_t{};
     wlearner.parameter("wlearner::dtree::min_split") = min_split;
     wlearner.parameter("wlearner::dtree::max_depth") = max_depth;
+    wlearner.parameter("wlearner::bins")             = bins;
     return wlearner;
 }
 } // namespace
@@ -46,7 +47,23 @@ public:
 
     void check_wlearner(const dtree_wlearner_t& wlearner) const
     {
-        UTEST_CHECK_EQUAL(wlearner.nodes(), expected_nodes());
+        if (wlearner.parameter("wlearner::bins").value<tensor_size_t>() == 0)
+        {
+            UTEST_CHECK_EQUAL(wlearner.nodes(), expected_nodes());
+        }
+        else
+        {
+            // NB: the thresholds are estimated from the quantized feature values, so they can differ!
+            const auto& nodes    = wlearner.nodes();
+            const auto  expected = expected_nodes();
+            UTEST_REQUIRE_EQUAL(nodes.size(), expected.size());
+            for (size_t i = 0; i < nodes.size(); ++i)
+            {
+                UTEST_CHECK_EQUAL(nodes[i].m_feature, expected[i].m_feature);
+                UTEST_CHECK_EQUAL(nodes[i].m_next, expected[i].m_next);
+                UTEST_CHECK_EQUAL(nodes[i].m_table, expected[i].m_table);
+            }
+        }
         UTEST_CHECK_EQUAL(wlearner.features(), expected_features());
         UTEST_CHECK_CLOSE(wlearner.tables(), expected_tables(), 1e-13);
     }
@@ -214,8 +231,9 @@ private:
 class wdtree_depth3_datasource_t final : public wdtree_datasource_t
 {
 public:
-    explicit wdtree_depth3_datasource_t(const tensor_size_t samples)
+    explicit wdtree_depth3_datasource_t(const tensor_size_t samples, const int bins = 0)
         : wdtree_datasource_t(samples, 8)
+        , m_bins(bins)
     {
     }
 
@@ -265,7 +283,7 @@ public:
 
     rdatasource_t clone() const override { return std::make_unique<wdtree_depth3_datasource_t>(*this); }
 
-    dtree_wlearner_t make_wlearner() const override { return make_wdtree(1, 3); }
+    dtree_wlearner_t make_wlearner() const override { return make_wdtree(1, 3, m_bins); }
 
     indices_t expected_features() const override
     {
@@ -300,6 +318,8 @@ public:
     }
 
 private:
+    int m_bins{0};
+
     void do_load() override
     {
         random_datasource_t::do_load();
@@ -431,4 +451,12 @@ UTEST_CASE(fit_predict_depth3)
     check_wlearner(datasource0, datasourceX);
 }
 
+UTEST_CASE(fit_predict_depth3_quantized)
+{
+    const auto datasource0 = make_datasource<wdtree_depth3_datasource_t>(800, 32);
+    const auto datasourceX = make_random_datasource(make_features_all_discrete());
+
+    check_wlearner(datasource0, datasourceX);
+}
+
 UTEST_END_MODULE()
@@ -8,8 +8,9 @@ using namespace nano;
 class fixture_datasource_t final : public wlearner_datasource_t
 {
 public:
-    explicit fixture_datasource_t(const tensor_size_t samples)
+    explicit fixture_datasource_t(const tensor_size_t samples, const int bins = 0)
         : wlearner_datasource_t(samples, 2)
+        , m_bins(bins)
     {
     }
 
@@ -30,7 +31,12 @@ public:
         return make_tensor<scalar_t>(make_dims(2, 1, 1, 1), expected_pred_lower(), expected_pred_upper());
     }
 
-    static auto make_wlearner() { return stump_wlearner_t{}; }
+    auto make_wlearner() const
+    {
+        auto wlearner                        = stump_wlearner_t{};
+        wlearner.parameter("wlearner::bins") = m_bins;
+        return wlearner;
+    }
 
     static auto make_compatible_wlearners()
     {
@@ -38,7 +44,7 @@ public:
         return wlearners;
     }
 
-    static auto make_incompatible_wlearners()
+    auto make_incompatible_wlearners() const
     {
         auto wlearners = rwlearners_t{};
         wlearners.emplace_back(affine_wlearner_t{}.clone());
@@ -56,6 +62,8 @@ public:
     }
 
 private:
+    int m_bins{0};
+
     void do_load() override
     {
         random_datasource_t::do_load();
@@ -81,4 +89,57 @@ UTEST_CASE(fit_predict)
     check_wlearner(datasource0, datasourceX);
 }
 
+UTEST_CASE(fit_predict_quantized)
+{
+    const auto datasource0 = make_datasource<fixture_datasource_t>(200, 16);
+    const auto datasourceX = make_random_datasource(make_features_all_discrete());
+
+    check_wlearner(datasource0, datasourceX);
+}
+
+UTEST_CASE(predict_parallel)
+{
+    const auto datasource = make_datasource<fixture_datasource_t>(5000);
+    const auto dataset    = make_dataset(datasource);
+    const auto samples    = make_all_samples(dataset);
+
+    auto wlearner = datasource.make_wlearner();
+    check_fit(wlearner, dataset);
+    fixture_datasource_t::check_wlearner(wlearner);
+
+    // the feature values of small batches of samples are processed sequentially
+    auto expected_outputs = tensor4d_t{cat_dims(samples.size(), dataset.target_dims())};
+    auto expected_cluster = cluster_t{dataset.samples(), 2};
+    for (tensor_size_t begin = 0; begin < samples.size(); begin += 500)
+    {
+        const auto end   = std::min(begin + 500, samples.size());
+        const auto batch = indices_t{samples.slice(begin, end)};
+
+        expected_outputs.slice(begin, end) = wlearner.predict(dataset, batch);
+
+        const auto cluster = wlearner.split(dataset, batch);
+        for (tensor_size_t i = begin; i < end; ++i)
+        {
+            if (const auto group = cluster.group(samples(i)); group >= 0)
+            {
+                expected_cluster.assign(samples(i), group);
+            }
+        }
+    }
+
+    // the feature values of large batches of samples are processed in parallel
+    check_split(wlearner, dataset, expected_cluster);
+    UTEST_CHECK_CLOSE(wlearner.predict(dataset, samples), expected_outputs, 1e-12);
+
+    // ... and the processing is reentrant from within the tasks of the thread pool
+    auto outputs = std::vector<tensor4d_t>(4U);
+    dataset.thread_pool().map(static_cast<tensor_size_t>(outputs.size()),
+                              [&](const tensor_size_t index, size_t)
+                              { outputs[static_cast<size_t>(index)] = wlearner.predict(dataset, samples); });
+    for (const auto& output : outputs)
+    {
+        UTEST_CHECK_CLOSE(output, expected_outputs, 1e-12);
+    }
+}
+
 UTEST_END_MODULE()
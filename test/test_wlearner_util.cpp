@@ -1,6 +1,7 @@
 #include <nano/core/reduce.h>
 #include <nano/wlearner/accumulator.h>
 #include <nano/wlearner/criterion.h>
+#include <nano/wlearner/histogram.h>
 #include <nano/wlearner/util.h>
 #include <numbers>
 #include <utest/utest.h>
@@ -249,6 +250,58 @@ UTEST_CASE(accumulator_cluster)
                                                              2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0));
 }
 
+UTEST_CASE(histogram)
+{
+    const auto tdims = make_dims(2, 1, 1);
+
+    const auto codes =
+        make_tensor<uint8_t>(make_dims(8), 0, 1, 2, 2, quantized_features_t::missing_bin, 0, 1, 2);
+    const auto gradients =
+        make_tensor<scalar_t>(cat_dims(8, tdims), +1.0, +1.1, +0.9, +1.0, -1.0, -1.1, -2.0, -2.1, -2.0, -2.2, +3.0,
+                              +3.0, +1.0, +1.2, -2.1, -1.9);
+
+    const auto all_samples   = arange(0, 8);
+    const auto small_samples = make_indices(1, 4, 7);
+    const auto large_samples = make_indices(0, 2, 3, 5, 6);
+
+    auto histogram_all = wlearner::histogram_t{tdims};
+    histogram_all.clear(3);
+    histogram_all.update(gradients, codes.tensor(), all_samples);
+
+    auto histogram_small = wlearner::histogram_t{tdims};
+    histogram_small.clear(3);
+    histogram_small.update(gradients, codes.tensor(), small_samples);
+
+    auto histogram_large = wlearner::histogram_t{tdims};
+    histogram_large.clear(3);
+    histogram_large.update(gradients, codes.tensor(), large_samples);
+
+    UTEST_CHECK_EQUAL(histogram_all.bins(), 3);
+    UTEST_CHECK_CLOSE(histogram_all.missing_cnt(), 1.0, 1e-12);
+    UTEST_CHECK_CLOSE(histogram_all.missing_rss(), 8.84, 1e-12);
+
+    // NB: the histogram of a subset of samples is obtained by subtracting the complementary histogram!
+    histogram_all.subtract(histogram_small);
+
+    UTEST_CHECK_CLOSE(histogram_all.missing_cnt(), 0.0, 1e-12);
+    UTEST_CHECK_CLOSE(histogram_all.missing_rss(), 0.0, 1e-12);
+
+    for (const auto criterion : enum_values<wlearner_criterion>())
+    {
+        const auto [score_large, bin_large] = histogram_large.fit(criterion);
+        const auto [score_all, bin_all]     = histogram_all.fit(criterion);
+
+        UTEST_CHECK_EQUAL(bin_all, bin_large);
+        UTEST_CHECK_CLOSE(score_all, score_large, 1e-12);
+        UTEST_CHECK_CLOSE(histogram_all.tables(), histogram_large.tables(), 1e-12);
+    }
+
+    // NB: the gradients of the largest subset are best separated between the first two bins and the last one!
+    const auto [score, bin] = histogram_large.fit(wlearner_criterion::rss);
+    UTEST_CHECK_EQUAL(bin, 1);
+    UTEST_CHECK_CLOSE(score, 12.65 - 20.09 / 3.0, 1e-12);
+}
+
 UTEST_CASE(criterion)
 {
     const auto rss = std::numbers::e;